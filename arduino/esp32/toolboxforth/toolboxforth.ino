@@ -9,6 +9,7 @@ extern "C" {
 }
 
 #include <esp_task_wdt.h>
+#include <esp_timer.h>
 
 // define if using USB_CDC for console and don't want delays when not plugged in
 //
@@ -209,9 +210,33 @@ tbforth_stat c_handle(void) {
   case OS_MS:		/* milliseconds */
     dpush(millis());
     break;
+  case OS_US:		/* microseconds */
+    dpush(micros());
+    break;
+  case OS_NS:		/* esp_timer counts us (64 bits) */
+    dpush64((uint64_t)esp_timer_get_time() * 1000);
+    break;
+  case OS_CYCLES:	/* CCOUNT, 32 bits */
+    dpush64((uint64_t)ESP.getCycleCount());
+    break;
+  case OS_IDLE:			/* nothing to run for a while */
+    delay(dpop());
+    break;
   case OS_EMIT:			/* emit */
     txc(dpop()&0xff);
     break;
+  case OS_TYPE:			/* type */
+    {
+      RAMC n = dpop(), a = dpop();
+      if ((int32_t)n > 0)
+	txs((a & 0x80000000) ? (char*)&tbforth_ram[a & 0x7FFFFFFF] :
+	    (char*)&tbforth_dict[a], n);
+    }
+    break;
+  case OS_FLUSH:
+    (void)dpop();
+    Serial.flush();
+    break;
   case OS_KEY:			/* key */
     dpush((CELL)rxc());
     break;
@@ -333,7 +358,7 @@ void console() {
   }
 }
 
-struct dict  *dict = &flashdict;
+TBFORTH_TLS struct dict  *dict = &flashdict;
 
 void setup () {
   Serial.begin(115200);
@@ -56,9 +56,27 @@ tbforth_stat c_handle(void) {
   case OS_MS:		/* milliseconds */
     dpush(millis());
     break;
+  case OS_US:		/* microseconds */
+    dpush(micros());
+    break;
+  case OS_IDLE:			/* nothing to run for a while */
+    delay(dpop());
+    break;
   case OS_EMIT:			/* emit */
     txc(dpop()&0xff);
     break;
+  case OS_TYPE:			/* type */
+    {
+      RAMC n = dpop(), a = dpop();
+      if ((int32_t)n > 0)
+	txs((a & 0x80000000) ? (char*)&tbforth_ram[a & 0x7FFFFFFF] :
+	    (char*)&tbforth_dict[a], n);
+    }
+    break;
+  case OS_FLUSH:
+    (void)dpop();
+    Serial.flush();
+    break;
   case OS_KEY:			/* key */
     dpush((CELL)rxc());
     break;
@@ -160,7 +178,7 @@ void console() {
   }
 }
 
-struct dict  *dict; // &flashdict;
+TBFORTH_TLS struct dict  *dict; // &flashdict;
 
 void setup () {
   dict = &flashdict;
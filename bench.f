@@ -0,0 +1,62 @@
+\ Benchmark corpus for tbforth-bench (make bench). Each bench-* word
+\ takes an iteration count ( n - ) and leaves the stack as it found it.
+\ Load after tests.f, examples/b64.f and tasks.f (tbforth-bench does).
+
+\ Loops
+\
+: bench-for ( n - ) for r@ drop next ;
+: bench-do ( n - ) 0 do i drop loop ;
+: bench-until ( n - ) begin 1- dup 0= until drop ;
+: bench-tail ( n - ) 1- dup 0> if bench-tail then drop ;
+
+\ Recursion (factorial and factor are from tests.f)
+\
+: fib ( n - n ) dup 2 < if exit then dup 1- recurse swap 2 - recurse + ;
+: bench-fib ( n - ) 0 do 20 fib drop loop ;
+: bench-factorial ( n - ) 0 do 12 factorial drop loop ;
+: bench-factor ( n - ) 0 do 10007 factor loop ;
+
+\ Strings: 60 bytes from the dictionary into RAM and back
+\
+create bench-text ," The quick brown fox jumps over the lazy dog, twice: 0123456789"
+variable bench-buf 20 allot
+
+: bench-bcopy ( n - )
+    0 do bench-text 2 bench-buf 0 60 bcopy loop ;
+: bench-bstr= ( n - )
+    bench-text 2 bench-buf 0 60 bcopy
+    0 do bench-text 2 bench-buf 0 60 bstr= drop loop ;
+
+\ Dictionary lookup: (find) wants a counted string in RAM, as next-word
+\ returns it. Names up to 16 characters.
+\
+: name>ram ( ram <name> - ) >r next-word 0 r> 0 20 bcopy ;
+variable fname1 4 allot  fname1 name>ram dup
+variable fname2 4 allot  fname2 name>ram forget-to-mark
+variable fname3 4 allot  fname3 name>ram bench-text
+variable fname4 4 allot  fname4 name>ram no-such-word
+
+: bench-find ( n - )
+    0 do
+	fname1 (find) 2drop fname2 (find) 2drop
+	fname3 (find) 2drop fname4 (find) 2drop
+    loop ;
+
+\ Base64 (examples/b64.f): 60 bytes out and back
+\
+variable b64-buf 40 allot
+: bench-b64 ( n - )
+    0 do
+	bench-text count pad b64encode
+	pad count b64-buf b64decode
+    loop ;
+
+\ Task switching (tsk1, tsk2 from tasks.f): two tasks yield n times each
+\
+variable tasks-left
+variable bench-n
+: ping ( - ) bench-n @ 0 do yield loop -1 tasks-left +! ;
+: bench-switch ( n - )
+    bench-n ! 2 tasks-left !
+    ['] ping tsk1 spawn drop ['] ping tsk2 spawn drop
+    begin yield tasks-left @ 0= until ;
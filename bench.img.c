@@ -0,0 +1,2721 @@
+/*
+  The colon definitions of a tbforth dictionary (6553 cells) as C,
+  by tbforth-aot (see tbforth_aot() in tbforth.c). Don't edit.
+*/
+#include "tbforth.h"
+
+#if DICT_VERSION != 32
+#error "translated for another dictionary version"
+#endif
+#define N_NATIVE 107
+#ifdef GUARD_RAILS
+#define N_GUARDED 1
+#else
+#define N_GUARDED 0
+#endif
+
+/* sp: top of data stack, rp: top of return stack, re: rp on entry */
+#define ENTER() RAMC *ds, *sp, *rp, re, t; tbforth_stat st; \
+  FILL(); re = rp - ds; (void)t; (void)st; (void)re
+#define SPILL() (tbforth_uram->didx = sp - ds, tbforth_uram->ridx = rp - ds)
+#define FILL() (ds = tbforth_uram->ds, \
+  sp = ds + (int32_t)tbforth_uram->didx, rp = ds + tbforth_uram->ridx)
+#define RETURN() do { SPILL(); return U_OK; } while (0)
+#define PRIM(px) do { \
+    SPILL(); \
+    if ((st = tbforth_native_prim(px)) != U_OK) return st; \
+    FILL(); \
+  } while (0)
+/* Call xt with ret on the return stack, as the interpreter would */
+#define CALL_(call, ret) do { \
+    RAMC r_ = rp - ds; \
+    *--rp = (ret); \
+    SPILL(); \
+    if ((st = call) != U_OK) return st; \
+    FILL(); \
+    if ((RAMC)(rp - ds) != r_ - 1 || *rp != (ret)) \
+      return tbforth_native_return(re, r_); \
+    rp++; \
+  } while (0)
+#define CALL(xt, fn, ret) \
+  CALL_(tbforth_dict[xt] == N_NATIVE ? fn() : tbforth_native_exec(xt), ret)
+#define XCALL(xt, ret) CALL_(tbforth_native_exec(xt), ret)
+#define FETCH() do { \
+    t = *sp--; \
+    if (t & 0x80000000) { \
+      SPILL(); \
+      t = tbforth_ram[t & 0x7FFFFFFF]; \
+    } else if (tbforth_dict[t] == N_NATIVE) \
+      t = tbforth_native_first(t); \
+    else \
+      t = tbforth_dict[t]; \
+    *++sp = t; \
+  } while (0)
+#define STORE(px) do { \
+    t = *sp; \
+    if ((t & 0x80000000) && !N_GUARDED) { \
+      sp -= 2; \
+      SPILL(); \
+      tbforth_ram[t & 0x7FFFFFFF] = sp[1]; \
+      FILL(); \
+    } else \
+      PRIM(px); \
+  } while (0)
+
+static tbforth_stat w_454(void);
+static tbforth_stat w_467(void);
+static tbforth_stat w_480(void);
+static tbforth_stat w_496(void);
+static tbforth_stat w_504(void);
+static tbforth_stat w_512(void);
+static tbforth_stat w_521(void);
+static tbforth_stat w_532(void);
+static tbforth_stat w_540(void);
+static tbforth_stat w_547(void);
+static tbforth_stat w_557(void);
+static tbforth_stat w_566(void);
+static tbforth_stat w_579(void);
+static tbforth_stat w_593(void);
+static tbforth_stat w_606(void);
+static tbforth_stat w_620(void);
+static tbforth_stat w_631(void);
+static tbforth_stat w_641(void);
+static tbforth_stat w_653(void);
+static tbforth_stat w_665(void);
+static tbforth_stat w_674(void);
+static tbforth_stat w_684(void);
+static tbforth_stat w_696(void);
+static tbforth_stat w_705(void);
+static tbforth_stat w_716(void);
+static tbforth_stat w_724(void);
+static tbforth_stat w_734(void);
+static tbforth_stat w_745(void);
+static tbforth_stat w_756(void);
+static tbforth_stat w_766(void);
+static tbforth_stat w_775(void);
+static tbforth_stat w_782(void);
+static tbforth_stat w_790(void);
+static tbforth_stat w_800(void);
+static tbforth_stat w_809(void);
+static tbforth_stat w_816(void);
+static tbforth_stat w_821(void);
+static tbforth_stat w_827(void);
+static tbforth_stat w_833(void);
+static tbforth_stat w_840(void);
+static tbforth_stat w_848(void);
+static tbforth_stat w_855(void);
+static tbforth_stat w_864(void);
+static tbforth_stat w_872(void);
+static tbforth_stat w_883(void);
+static tbforth_stat w_891(void);
+static tbforth_stat w_899(void);
+static tbforth_stat w_914(void);
+static tbforth_stat w_925(void);
+static tbforth_stat w_932(void);
+static tbforth_stat w_939(void);
+static tbforth_stat w_948(void);
+static tbforth_stat w_955(void);
+static tbforth_stat w_967(void);
+static tbforth_stat w_978(void);
+static tbforth_stat w_988(void);
+static tbforth_stat w_1005(void);
+static tbforth_stat w_1021(void);
+static tbforth_stat w_1036(void);
+static tbforth_stat w_1046(void);
+static tbforth_stat w_1055(void);
+static tbforth_stat w_1064(void);
+static tbforth_stat w_1080(void);
+static tbforth_stat w_1097(void);
+static tbforth_stat w_1111(void);
+static tbforth_stat w_1131(void);
+static tbforth_stat w_1139(void);
+static tbforth_stat w_1147(void);
+static tbforth_stat w_1159(void);
+static tbforth_stat w_1191(void);
+static tbforth_stat w_1205(void);
+static tbforth_stat w_1217(void);
+static tbforth_stat w_1233(void);
+static tbforth_stat w_1242(void);
+static tbforth_stat w_1259(void);
+static tbforth_stat w_1320(void);
+static tbforth_stat w_1332(void);
+static tbforth_stat w_1350(void);
+static tbforth_stat w_1357(void);
+static tbforth_stat w_1370(void);
+static tbforth_stat w_1385(void);
+static tbforth_stat w_1402(void);
+static tbforth_stat w_1415(void);
+static tbforth_stat w_1446(void);
+static tbforth_stat w_1455(void);
+static tbforth_stat w_1462(void);
+static tbforth_stat w_1470(void);
+static tbforth_stat w_2168(void);
+static tbforth_stat w_2176(void);
+static tbforth_stat w_2186(void);
+static tbforth_stat w_2199(void);
+static tbforth_stat w_2209(void);
+static tbforth_stat w_2245(void);
+static tbforth_stat w_2264(void);
+static tbforth_stat w_2275(void);
+static tbforth_stat w_2285(void);
+static tbforth_stat w_2293(void);
+static tbforth_stat w_2302(void);
+static tbforth_stat w_2319(void);
+static tbforth_stat w_2336(void);
+static tbforth_stat w_2350(void);
+static tbforth_stat w_2365(void);
+static tbforth_stat w_2376(void);
+static tbforth_stat w_2412(void);
+static tbforth_stat w_2445(void);
+static tbforth_stat w_2464(void);
+static tbforth_stat w_2712(void);
+static tbforth_stat w_2736(void);
+static tbforth_stat w_2753(void);
+static tbforth_stat w_2763(void);
+static tbforth_stat w_2786(void);
+static tbforth_stat w_2820(void);
+static tbforth_stat w_2836(void);
+static tbforth_stat w_2852(void);
+static tbforth_stat w_2866(void);
+static tbforth_stat w_2883(void);
+static tbforth_stat w_2909(void);
+static tbforth_stat w_2984(void);
+static tbforth_stat w_3065(void);
+static tbforth_stat w_3150(void);
+static tbforth_stat w_3513(void);
+static tbforth_stat w_3572(void);
+static tbforth_stat w_3582(void);
+static tbforth_stat w_3601(void);
+static tbforth_stat w_3635(void);
+static tbforth_stat w_3781(void);
+static tbforth_stat w_3792(void);
+static tbforth_stat w_4026(void);
+static tbforth_stat w_4035(void);
+static tbforth_stat w_4078(void);
+static tbforth_stat w_4113(void);
+static tbforth_stat w_4141(void);
+static tbforth_stat w_4166(void);
+static tbforth_stat w_4198(void);
+static tbforth_stat w_4216(void);
+static tbforth_stat w_4236(void);
+static tbforth_stat w_4414(void);
+static tbforth_stat w_4421(void);
+static tbforth_stat w_4430(void);
+static tbforth_stat w_4480(void);
+static tbforth_stat w_4499(void);
+static tbforth_stat w_4587(void);
+static tbforth_stat w_4598(void);
+static tbforth_stat w_4774(void);
+static tbforth_stat w_4783(void);
+static tbforth_stat w_4794(void);
+static tbforth_stat w_4846(void);
+static tbforth_stat w_4865(void);
+static tbforth_stat w_4917(void);
+static tbforth_stat w_4970(void);
+static tbforth_stat w_5049(void);
+static tbforth_stat w_5206(void);
+static tbforth_stat w_5214(void);
+static tbforth_stat w_5222(void);
+static tbforth_stat w_5347(void);
+static tbforth_stat w_5554(void);
+static tbforth_stat w_5984(void);
+static tbforth_stat w_6005(void);
+static tbforth_stat w_6039(void);
+static tbforth_stat w_6054(void);
+static tbforth_stat w_6069(void);
+static tbforth_stat w_6096(void);
+static tbforth_stat w_6132(void);
+static tbforth_stat w_6166(void);
+static tbforth_stat w_6198(void);
+static tbforth_stat w_6240(void);
+static tbforth_stat w_6252(void);
+static tbforth_stat w_6289(void);
+static tbforth_stat w_6332(void);
+static tbforth_stat w_6346(void);
+static tbforth_stat w_6355(void);
+static tbforth_stat w_6364(void);
+static tbforth_stat w_6373(void);
+static tbforth_stat w_6384(void);
+static tbforth_stat w_6428(void);
+static tbforth_stat w_6439(void);
+static tbforth_stat w_6476(void);
+static tbforth_stat w_6486(void);
+
+/* : */
+static tbforth_stat w_454(void) {
+  ENTER();
+  PRIM(246);	/* (create) */
+  *++sp = 1u;
+  PRIM(356);	/* iram */
+  STORE(181);
+  PRIM(373);	/* here */
+  *++sp = 2u;
+  PRIM(356);	/* iram */
+  sp[-1] += sp[0]; sp--;
+  STORE(181);
+  RETURN();
+}
+
+/* \ */
+static tbforth_stat w_467(void) {
+  ENTER();
+ L467:
+  PRIM(262);	/* next-char */
+  *++sp = 0u;
+  sp[-1] -= sp[0]; sp--;
+  if (*sp-- == 0) goto L476;
+  goto L467;
+ L476:
+  RETURN();
+}
+
+/* ( */
+static tbforth_stat w_480(void) {
+  ENTER();
+ L480:
+  PRIM(262);	/* next-char */
+  sp[0] -= 41u;
+  if (*sp-- == 0) goto L490;
+  goto L480;
+ L490:
+  RETURN();
+}
+
+/* RCELL */
+static tbforth_stat w_496(void) {
+  ENTER();
+  *++sp = 4u;
+  RETURN();
+}
+
+/* DCELL */
+static tbforth_stat w_504(void) {
+  ENTER();
+  *++sp = 2u;
+  RETURN();
+}
+
+/* dversion */
+static tbforth_stat w_512(void) {
+  ENTER();
+  *++sp = 0u;
+  FETCH();
+  RETURN();
+}
+
+/* cellsize */
+static tbforth_stat w_521(void) {
+  ENTER();
+  *++sp = 1u;
+  FETCH();
+  RETURN();
+}
+
+/* maxdictcells */
+static tbforth_stat w_532(void) {
+  ENTER();
+  *++sp = 2u;
+  FETCH();
+  RETURN();
+}
+
+/* (here) */
+static tbforth_stat w_540(void) {
+  ENTER();
+  *++sp = 3u;
+  RETURN();
+}
+
+/* lwa */
+static tbforth_stat w_547(void) {
+  ENTER();
+  *++sp = 4u;
+  RETURN();
+}
+
+/* uram-used */
+static tbforth_stat w_557(void) {
+  ENTER();
+  *++sp = 5u;
+  FETCH();
+  RETURN();
+}
+
+/* state? */
+static tbforth_stat w_566(void) {
+  ENTER();
+  *++sp = 0u;
+  PRIM(356);	/* iram */
+  sp[-1] += sp[0]; sp--;
+  FETCH();
+  RETURN();
+}
+
+/* reset-state */
+static tbforth_stat w_579(void) {
+  ENTER();
+  *++sp = 0u;
+  *++sp = 0u;
+  PRIM(356);	/* iram */
+  sp[-1] += sp[0]; sp--;
+  STORE(181);
+  RETURN();
+}
+
+/* is-compiling */
+static tbforth_stat w_593(void) {
+  ENTER();
+  *++sp = 1u;
+  *++sp = 0u;
+  PRIM(356);	/* iram */
+  sp[-1] += sp[0]; sp--;
+  STORE(181);
+  RETURN();
+}
+
+/* compiling? */
+static tbforth_stat w_606(void) {
+  ENTER();
+  CALL(566, w_566, 607);	/* state? */
+  *++sp = 1u;
+  sp[-1] = -(sp[-1] == sp[0]); sp--;
+  RETURN();
+}
+
+/* compiling-word! */
+static tbforth_stat w_620(void) {
+  ENTER();
+  *++sp = 2u;
+  PRIM(356);	/* iram */
+  sp[-1] += sp[0]; sp--;
+  STORE(181);
+  RETURN();
+}
+
+/* ramsize */
+static tbforth_stat w_631(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(356);	/* iram */
+  sp[-1] += sp[0]; sp--;
+  FETCH();
+  RETURN();
+}
+
+/* tibidx */
+static tbforth_stat w_641(void) {
+  ENTER();
+  PRIM(356);	/* iram */
+  sp[0] += 3u;
+  RETURN();
+}
+
+/* tibwordidx */
+static tbforth_stat w_653(void) {
+  ENTER();
+  PRIM(356);	/* iram */
+  sp[0] += 4u;
+  RETURN();
+}
+
+/* tibwordlen */
+static tbforth_stat w_665(void) {
+  ENTER();
+  PRIM(356);	/* iram */
+  sp[0] += 5u;
+  RETURN();
+}
+
+/* tib */
+static tbforth_stat w_674(void) {
+  ENTER();
+  PRIM(356);	/* iram */
+  sp[0] += 6u;
+  RETURN();
+}
+
+/* tibbuf */
+static tbforth_stat w_684(void) {
+  ENTER();
+  PRIM(356);	/* iram */
+  sp[0] += 7u;
+  RETURN();
+}
+
+/* uram-size */
+static tbforth_stat w_696(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  *++sp = 0u;
+  sp[-1] += sp[0]; sp--;
+  FETCH();
+  RETURN();
+}
+
+/* base */
+static tbforth_stat w_705(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  sp[0]++;
+  RETURN();
+}
+
+/* fp-places */
+static tbforth_stat w_716(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  *++sp = 2u;
+  sp[-1] += sp[0]; sp--;
+  RETURN();
+}
+
+/* sidx */
+static tbforth_stat w_724(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  sp[0] += 3u;
+  FETCH();
+  RETURN();
+}
+
+/* ridx */
+static tbforth_stat w_734(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  sp[0] += 4u;
+  FETCH();
+  RETURN();
+}
+
+/* dslen */
+static tbforth_stat w_745(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  sp[0] += 5u;
+  FETCH();
+  RETURN();
+}
+
+/* rslen */
+static tbforth_stat w_756(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  sp[0] += 6u;
+  FETCH();
+  RETURN();
+}
+
+/* dsa */
+static tbforth_stat w_766(void) {
+  ENTER();
+  PRIM(345);	/* uram */
+  sp[0] += 7u;
+  RETURN();
+}
+
+/* rsa */
+static tbforth_stat w_775(void) {
+  ENTER();
+  CALL(766, w_766, 776);	/* dsa */
+  CALL(745, w_745, 777);	/* dslen */
+  sp[-1] += sp[0]; sp--;
+  RETURN();
+}
+
+/* T */
+static tbforth_stat w_782(void) {
+  ENTER();
+  CALL(766, w_766, 783);	/* dsa */
+  CALL(724, w_724, 784);	/* sidx */
+  sp[-1] += sp[0]; sp--;
+  sp[0]--;
+  RETURN();
+}
+
+/* R */
+static tbforth_stat w_790(void) {
+  ENTER();
+  CALL(766, w_766, 791);	/* dsa */
+  CALL(734, w_734, 792);	/* ridx */
+  sp[-1] += sp[0]; sp--;
+  sp[0]++;
+  RETURN();
+}
+
+/* depth */
+static tbforth_stat w_800(void) {
+  ENTER();
+  CALL(724, w_724, 801);	/* sidx */
+  sp[0]++;
+  RETURN();
+}
+
+/* negate */
+static tbforth_stat w_809(void) {
+  ENTER();
+  *++sp = 4294967295u;
+  sp[-1] *= sp[0]; sp--;
+  RETURN();
+}
+
+/* not */
+static tbforth_stat w_816(void) {
+  ENTER();
+  sp[0] = -(sp[0] == 0);
+  RETURN();
+}
+
+/* 2+ */
+static tbforth_stat w_821(void) {
+  ENTER();
+  *++sp = 2u;
+  sp[-1] += sp[0]; sp--;
+  RETURN();
+}
+
+/* 2* */
+static tbforth_stat w_827(void) {
+  ENTER();
+  *++sp = 2u;
+  sp[-1] *= sp[0]; sp--;
+  RETURN();
+}
+
+/* 2/ */
+static tbforth_stat w_833(void) {
+  ENTER();
+  *++sp = 2u;
+  sp[-1] /= sp[0]; sp--;
+  RETURN();
+}
+
+/* 2dup */
+static tbforth_stat w_840(void) {
+  ENTER();
+  sp[1] = sp[-1]; sp++;
+  sp[1] = sp[-1]; sp++;
+  RETURN();
+}
+
+/* 2drop */
+static tbforth_stat w_848(void) {
+  ENTER();
+  sp--;
+  sp--;
+  RETURN();
+}
+
+/* nip */
+static tbforth_stat w_855(void) {
+  ENTER();
+  sp[1] = sp[-1]; sp++;
+  sp[-1] ^= sp[0]; sp--;
+  sp[-1] ^= sp[0]; sp--;
+  RETURN();
+}
+
+/* 2swap */
+static tbforth_stat w_864(void) {
+  ENTER();
+  t = sp[-2]; sp[-2] = sp[0]; sp[0] = t;
+  *--rp = *sp--;
+  t = sp[-2]; sp[-2] = sp[0]; sp[0] = t;
+  *++sp = *rp++;
+  RETURN();
+}
+
+/* +! */
+static tbforth_stat w_872(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  *--rp = *sp--;
+  FETCH(); sp[-1] += sp[0]; sp--;
+  *++sp = *rp++;
+  STORE(181);
+  RETURN();
+}
+
+/* incr */
+static tbforth_stat w_883(void) {
+  ENTER();
+  *++sp = 1u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  CALL(872, w_872, 886);	/* +! */
+  RETURN();
+}
+
+/* decr */
+static tbforth_stat w_891(void) {
+  ENTER();
+  *++sp = 4294967295u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  CALL(872, w_872, 894);	/* +! */
+  RETURN();
+}
+
+/* /mod */
+static tbforth_stat w_899(void) {
+  ENTER();
+  sp[1] = sp[-1]; sp++;
+  sp[1] = sp[-1]; sp++;
+  sp[-1] /= sp[0]; sp--;
+  *--rp = *sp--;
+  sp[-1] %= sp[0]; sp--;
+  *++sp = *rp++;
+  RETURN();
+}
+
+/* (find-head) */
+static tbforth_stat w_914(void) {
+  ENTER();
+  PRIM(293);	/* (find) */
+  sp--;
+  RETURN();
+}
+
+/* (find-code) */
+static tbforth_stat w_925(void) {
+  ENTER();
+  PRIM(293);	/* (find) */
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp--;
+  RETURN();
+}
+
+/* ' */
+static tbforth_stat w_932(void) {
+  ENTER();
+  PRIM(254);	/* next-word */
+  CALL(925, w_925, 934);	/* (find-code) */
+  RETURN();
+}
+
+/* ['] */
+static tbforth_stat w_939(void) {
+  ENTER();
+  PRIM(254);	/* next-word */
+  CALL(925, w_925, 941);	/* (find-code) */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* '& */
+static tbforth_stat w_948(void) {
+  ENTER();
+  PRIM(254);	/* next-word */
+  CALL(914, w_914, 950);	/* (find-head) */
+  RETURN();
+}
+
+/* ['&] */
+static tbforth_stat w_955(void) {
+  ENTER();
+  PRIM(254);	/* next-word */
+  CALL(914, w_914, 957);	/* (find-head) */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* postpone */
+static tbforth_stat w_967(void) {
+  ENTER();
+  PRIM(254);	/* next-word */
+  CALL(925, w_925, 969);	/* (find-code) */
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* [compile] */
+static tbforth_stat w_978(void) {
+  ENTER();
+  CALL(939, w_939, 979);	/* ['] */
+  *++sp = 46u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* create */
+static tbforth_stat w_988(void) {
+  ENTER();
+  PRIM(246);	/* (create) */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  CALL(821, w_821, 994);	/* 2+ */
+  PRIM(62);	/* , */
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* variable */
+static tbforth_stat w_1005(void) {
+  ENTER();
+  PRIM(246);	/* (create) */
+  *++sp = 3u;
+  PRIM(62);	/* , */
+  PRIM(287);	/* (allot1) */
+  PRIM(66);	/* d, */
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* constant */
+static tbforth_stat w_1021(void) {
+  ENTER();
+  PRIM(246);	/* (create) */
+  *++sp = 3u;
+  PRIM(62);	/* , */
+  PRIM(66);	/* d, */
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* is-ram? */
+static tbforth_stat w_1036(void) {
+  ENTER();
+  *++sp = 2147483648u;
+  sp[-1] &= sp[0]; sp--;
+  RETURN();
+}
+
+/* dict@ */
+static tbforth_stat w_1046(void) {
+  ENTER();
+  *++sp = 50u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* dict! */
+static tbforth_stat w_1055(void) {
+  ENTER();
+  *++sp = 51u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* ddict@ */
+static tbforth_stat w_1064(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  FETCH();
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp[0]++;
+  FETCH();
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *++sp = 16u;
+  sp[-1] <<= sp[0]; sp--;
+  sp[-1] |= sp[0]; sp--;
+  RETURN();
+}
+
+/* ddict! */
+static tbforth_stat w_1080(void) {
+  ENTER();
+  sp[1] = sp[-1]; sp++;
+  *++sp = 16u;
+  sp[-1] >>= sp[0]; sp--;
+  sp[1] = sp[-1]; sp++;
+  STORE(181);
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp[0] &= 65535u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp[0]++;
+  STORE(181);
+  RETURN();
+}
+
+/* if */
+static tbforth_stat w_1097(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  *++sp = 0u;
+  PRIM(62);	/* , */
+  *++sp = 23u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* else */
+static tbforth_stat w_1111(void) {
+  ENTER();
+  PRIM(373);	/* here */
+  sp[0] += 3u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  STORE(181);
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  *++sp = 0u;
+  PRIM(62);	/* , */
+  *++sp = 22u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* then */
+static tbforth_stat w_1131(void) {
+  ENTER();
+  PRIM(373);	/* here */
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  STORE(181);
+  RETURN();
+}
+
+/* exit */
+static tbforth_stat w_1139(void) {
+  ENTER();
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* for */
+static tbforth_stat w_1147(void) {
+  ENTER();
+  *++sp = 14u;
+  PRIM(62);	/* , */
+  *++sp = 48u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  RETURN();
+}
+
+/* next */
+static tbforth_stat w_1159(void) {
+  ENTER();
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 14u;
+  PRIM(62);	/* , */
+  *++sp = 35u;
+  PRIM(62);	/* , */
+  *++sp = 48u;
+  PRIM(62);	/* , */
+  *++sp = 32u;
+  PRIM(62);	/* , */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  *++sp = 23u;
+  PRIM(62);	/* , */
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 34u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* do */
+static tbforth_stat w_1191(void) {
+  ENTER();
+  *++sp = 36u;
+  PRIM(62);	/* , */
+  *++sp = 48u;
+  PRIM(62);	/* , */
+  *++sp = 48u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  RETURN();
+}
+
+/* i */
+static tbforth_stat w_1205(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  *++sp = 0u;
+  PRIM(62);	/* , */
+  *++sp = 10u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* j */
+static tbforth_stat w_1217(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  *++sp = 2u;
+  PRIM(62);	/* , */
+  *++sp = 10u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* _leaveloop */
+static tbforth_stat w_1233(void) {
+  ENTER();
+  *++sp = 2147483960u;
+  RETURN();
+}
+
+/* leave */
+static tbforth_stat w_1242(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  CALL(1233, w_1233, 1247);	/* _leaveloop */
+  STORE(181);
+  *++sp = 0u;
+  PRIM(62);	/* , */
+  *++sp = 22u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* +loop */
+static tbforth_stat w_1259(void) {
+  ENTER();
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 15u;
+  PRIM(62);	/* , */
+  *++sp = 35u;
+  PRIM(62);	/* , */
+  *++sp = 48u;
+  PRIM(62);	/* , */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  *++sp = 10u;
+  PRIM(62);	/* , */
+  *++sp = 44u;
+  PRIM(62);	/* , */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  *++sp = 23u;
+  PRIM(62);	/* , */
+  CALL(1233, w_1233, 1290);	/* _leaveloop */
+  FETCH();
+  *++sp = 0u;
+  sp[-1] = -((int32_t)sp[-1] > (int32_t)sp[0]); sp--;
+  if (*sp-- == 0) goto L1303;
+  PRIM(373);	/* here */
+  CALL(1233, w_1233, 1298);	/* _leaveloop */
+  FETCH();
+  STORE(181);
+  *++sp = 0u;
+  CALL(1233, w_1233, 1302);	/* _leaveloop */
+  STORE(181);
+ L1303:
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 34u;
+  PRIM(62);	/* , */
+  *++sp = 34u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* loop */
+static tbforth_stat w_1320(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  CALL(1259, w_1259, 1326);	/* +loop */
+  RETURN();
+}
+
+/* unloop */
+static tbforth_stat w_1332(void) {
+  ENTER();
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 34u;
+  PRIM(62);	/* , */
+  *++sp = 34u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* begin */
+static tbforth_stat w_1350(void) {
+  ENTER();
+  PRIM(373);	/* here */
+  RETURN();
+}
+
+/* again */
+static tbforth_stat w_1357(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  *++sp = 22u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* while */
+static tbforth_stat w_1370(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  *++sp = 0u;
+  PRIM(62);	/* , */
+  *++sp = 23u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* repeat */
+static tbforth_stat w_1385(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  *--rp = *sp--;
+  PRIM(62);	/* , */
+  *++sp = 22u;
+  PRIM(62);	/* , */
+  PRIM(373);	/* here */
+  *++sp = *rp++;
+  STORE(181);
+  RETURN();
+}
+
+/* until */
+static tbforth_stat w_1402(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  *++sp = 23u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* allot */
+static tbforth_stat w_1415(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L1419:
+  PRIM(287);	/* (allot1) */
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L1419;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* byte-allot */
+static tbforth_stat w_1446(void) {
+  ENTER();
+  CALL(496, w_496, 1447);	/* RCELL */
+  CALL(899, w_899, 1448);	/* /mod */
+  sp[-1] += sp[0]; sp--;
+  CALL(1415, w_1415, 1450);	/* allot */
+  RETURN();
+}
+
+/* pad */
+static tbforth_stat w_1455(void) {
+  ENTER();
+  *++sp = 2147483802u;
+  RETURN();
+}
+
+/* R1 */
+static tbforth_stat w_1462(void) {
+  ENTER();
+  *++sp = 2147483961u;
+  RETURN();
+}
+
+/* word */
+static tbforth_stat w_1470(void) {
+  ENTER();
+  CALL(1462, w_1462, 1471);	/* R1 */
+  STORE(181);
+  *++sp = 0u;
+  CALL(1455, w_1455, 1474);	/* pad */
+  STORE(181);
+ L1475:
+  PRIM(262);	/* next-char */
+  sp[1] = sp[0]; sp++;
+  CALL(1462, w_1462, 1478);	/* R1 */
+  FETCH();
+  sp[-1] = -(sp[-1] == sp[0]); sp--;
+  sp[1] = sp[-1]; sp++;
+  sp[0] = -(sp[0] == 0);
+  sp[-1] |= sp[0]; sp--;
+  if (*sp-- == 0) goto L1489;
+  sp--;
+  CALL(1455, w_1455, 1488);	/* pad */
+  RETURN();
+ L1489:
+  CALL(1455, w_1455, 1490);	/* pad */
+  PRIM(234);	/* c!+ */
+  goto L1475;
+}
+
+/* _endof */
+static tbforth_stat w_2168(void) {
+  ENTER();
+  *++sp = 2147483962u;
+  RETURN();
+}
+
+/* case */
+static tbforth_stat w_2176(void) {
+  ENTER();
+  *++sp = 0u;
+  CALL(2168, w_2168, 2178);	/* _endof */
+  STORE(181);
+  *++sp = 48u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* of */
+static tbforth_stat w_2186(void) {
+  ENTER();
+  *++sp = 9u;
+  PRIM(62);	/* , */
+  *++sp = 33u;
+  PRIM(62);	/* , */
+  CALL(1097, w_1097, 2193);	/* if */
+  RETURN();
+}
+
+/* endof */
+static tbforth_stat w_2199(void) {
+  ENTER();
+  CALL(2168, w_2168, 2200);	/* _endof */
+  CALL(883, w_883, 2201);	/* incr */
+  CALL(1111, w_1111, 2202);	/* else */
+  RETURN();
+}
+
+/* endcase */
+static tbforth_stat w_2209(void) {
+  ENTER();
+  CALL(2168, w_2168, 2210);	/* _endof */
+  FETCH();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L2215:
+  CALL(1131, w_1131, 2216);	/* then */
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L2215;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  *++sp = 49u;
+  PRIM(62);	/* , */
+  *++sp = 34u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* count */
+static tbforth_stat w_2245(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  FETCH();
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp[0]++;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  RETURN();
+}
+
+/* hex */
+static tbforth_stat w_2264(void) {
+  ENTER();
+  *++sp = 16u;
+  CALL(705, w_705, 2267);	/* base */
+  STORE(181);
+  RETURN();
+}
+
+/* decimal */
+static tbforth_stat w_2275(void) {
+  ENTER();
+  *++sp = 10u;
+  CALL(705, w_705, 2278);	/* base */
+  STORE(181);
+  RETURN();
+}
+
+/* binary */
+static tbforth_stat w_2285(void) {
+  ENTER();
+  *++sp = 2u;
+  CALL(705, w_705, 2287);	/* base */
+  STORE(181);
+  RETURN();
+}
+
+/* abs */
+static tbforth_stat w_2293(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  XCALL(2155, 2295);	/* exit-if0+ */
+  *++sp = 4294967295u;
+  sp[-1] *= sp[0]; sp--;
+  RETURN();
+}
+
+/* min */
+static tbforth_stat w_2302(void) {
+  ENTER();
+  sp[1] = sp[-1]; sp++;
+  sp[1] = sp[-1]; sp++;
+  sp[-1] = -((int32_t)sp[-1] > (int32_t)sp[0]); sp--;
+  if (*sp-- == 0) goto L2313;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp--;
+  goto L2314;
+ L2313:
+  sp--;
+ L2314:
+  RETURN();
+}
+
+/* max */
+static tbforth_stat w_2319(void) {
+  ENTER();
+  sp[1] = sp[-1]; sp++;
+  sp[1] = sp[-1]; sp++;
+  sp[-1] = -((int32_t)sp[-1] < (int32_t)sp[0]); sp--;
+  if (*sp-- == 0) goto L2330;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp--;
+  goto L2331;
+ L2330:
+  sp--;
+ L2331:
+  RETURN();
+}
+
+/* char */
+static tbforth_stat w_2336(void) {
+  ENTER();
+  *++sp = 32u;
+  CALL(1470, w_1470, 2339);	/* word */
+  sp[0]++;
+  FETCH();
+  sp[0] &= 255u;
+  RETURN();
+}
+
+/* [char] */
+static tbforth_stat w_2350(void) {
+  ENTER();
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  *++sp = 32u;
+  CALL(1470, w_1470, 2356);	/* word */
+  sp[0]++;
+  FETCH();
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* defer */
+static tbforth_stat w_2365(void) {
+  ENTER();
+  PRIM(246);	/* (create) */
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* is */
+static tbforth_stat w_2376(void) {
+  ENTER();
+  CALL(606, w_606, 2377);	/* compiling? */
+  if (*sp-- == 0) goto L2391;
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  CALL(932, w_932, 2384);	/* ' */
+  PRIM(62);	/* , */
+  *++sp = 51u;
+  PRIM(62);	/* , */
+  goto L2393;
+ L2391:
+  CALL(932, w_932, 2392);	/* ' */
+  STORE(181);
+ L2393:
+  RETURN();
+}
+
+/* /console */
+static tbforth_stat w_2412(void) {
+  ENTER();
+  *++sp = 1576u;
+  *++sp = 2398u;
+  STORE(181);
+  *++sp = 1592u;
+  *++sp = 2404u;
+  STORE(181);
+  RETURN();
+}
+
+/* s" */
+static tbforth_stat w_2445(void) {
+  ENTER();
+  CALL(606, w_606, 2446);	/* compiling? */
+  if (*sp-- == 0) goto L2456;
+  PRIM(224);	/* ," */
+  *++sp = 2245u;
+  PRIM(62);	/* , */
+  goto L2460;
+ L2456:
+  *++sp = 34u;
+  CALL(1470, w_1470, 2459);	/* word */
+  CALL(2245, w_2245, 2460);	/* count */
+ L2460:
+  RETURN();
+}
+
+/* c" */
+static tbforth_stat w_2464(void) {
+  ENTER();
+  CALL(606, w_606, 2465);	/* compiling? */
+  if (*sp-- == 0) goto L2472;
+  PRIM(224);	/* ," */
+  goto L2475;
+ L2472:
+  *++sp = 34u;
+  CALL(1470, w_1470, 2475);	/* word */
+ L2475:
+  RETURN();
+}
+
+/* recurse */
+static tbforth_stat w_2712(void) {
+  ENTER();
+  CALL(547, w_547, 2713);	/* lwa */
+  FETCH();
+  sp[0]++;
+  CALL(2245, w_2245, 2716);	/* count */
+  sp[0] &= 63u;
+  *++sp = 2u;
+  CALL(899, w_899, 2721);	/* /mod */
+  sp[-1] += sp[0]; sp--;
+  sp[-1] += sp[0]; sp--;
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  *++sp = 41u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* caddr */
+static tbforth_stat w_2736(void) {
+  ENTER();
+  PRIM(246);	/* (create) */
+  *++sp = 3u;
+  PRIM(62);	/* , */
+  PRIM(66);	/* d, */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* A+! */
+static tbforth_stat w_2753(void) {
+  ENTER();
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  PRIM(189);	/* A! */
+  PRIM(198);	/* A+ */
+  RETURN();
+}
+
+/* assert" */
+static tbforth_stat w_2763(void) {
+  ENTER();
+  *++sp = 30u;
+  PRIM(62);	/* , */
+  CALL(1097, w_1097, 2767);	/* if */
+  PRIM(224);	/* ," */
+  *++sp = 2245u;
+  PRIM(62);	/* , */
+  *++sp = 2480u;
+  PRIM(62);	/* , */
+  *++sp = 4u;
+  PRIM(62);	/* , */
+  CALL(1131, w_1131, 2778);	/* then */
+  RETURN();
+}
+
+/* dbytes>pad */
+static tbforth_stat w_2786(void) {
+  ENTER();
+  CALL(2245, w_2245, 2787);	/* count */
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L2791:
+  sp[1] = sp[0]; sp++;
+  sp[1] = rp[0]; sp++;
+  PRIM(239);	/* +c@ */
+  CALL(1455, w_1455, 2797);	/* pad */
+  PRIM(234);	/* c!+ */
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L2791;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* ?dup */
+static tbforth_stat w_2820(void) {
+  ENTER();
+  sp[1] = -(sp[0] == 0); sp++;
+  if (*sp-- == 0) goto L2826;
+  sp--;
+ L2826:
+  RETURN();
+}
+
+/* is-immediate? */
+static tbforth_stat w_2836(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  sp[0]++;
+  FETCH();
+  sp[0] &= 128u;
+  RETURN();
+}
+
+/* is-primitive? */
+static tbforth_stat w_2852(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  sp[0]++;
+  FETCH();
+  sp[0] &= 64u;
+  RETURN();
+}
+
+/* is-inline? */
+static tbforth_stat w_2866(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  sp[0]++;
+  FETCH();
+  sp[0] &= 256u;
+  RETURN();
+}
+
+/* to */
+static tbforth_stat w_2883(void) {
+  ENTER();
+  CALL(606, w_606, 2884);	/* compiling? */
+  if (*sp-- == 0) goto L2901;
+  *++sp = 3u;
+  PRIM(62);	/* , */
+  CALL(932, w_932, 2891);	/* ' */
+  PRIM(66);	/* d, */
+  *++sp = 13u;
+  PRIM(62);	/* , */
+  *++sp = 1080u;
+  PRIM(62);	/* , */
+  goto L2904;
+ L2901:
+  CALL(932, w_932, 2902);	/* ' */
+  sp[0]++;
+  CALL(1080, w_1080, 2904);	/* ddict! */
+ L2904:
+  RETURN();
+}
+
+/* mark */
+static tbforth_stat w_2909(void) {
+  ENTER();
+  PRIM(373);	/* here */
+  PRIM(246);	/* (create) */
+  *++sp = 1u;
+  PRIM(62);	/* , */
+  PRIM(62);	/* , */
+  *++sp = 25u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* DEBUG */
+static tbforth_stat w_2984(void) {
+  ENTER();
+  *++sp = 0u;
+  RETURN();
+}
+
+/* debug" */
+static tbforth_stat w_3065(void) {
+  ENTER();
+  CALL(2445, w_2445, 3066);	/* s" */
+  *++sp = 2994u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* debug-exec */
+static tbforth_stat w_3150(void) {
+  ENTER();
+  CALL(939, w_939, 3151);	/* ['] */
+  *++sp = 3078u;
+  PRIM(62);	/* , */
+  RETURN();
+}
+
+/* (@+) */
+static tbforth_stat w_3513(void) {
+  ENTER();
+  PRIM(214);	/* (c@+) */
+  PRIM(214);	/* (c@+) */
+  *++sp = 8u;
+  sp[-1] <<= sp[0]; sp--;
+  sp[-1] += sp[0]; sp--;
+  RETURN();
+}
+
+/* name */
+static tbforth_stat w_3572(void) {
+  ENTER();
+  sp[0]++;
+  CALL(2245, w_2245, 3574);	/* count */
+  sp[0] &= 63u;
+  RETURN();
+}
+
+/* cfa */
+static tbforth_stat w_3582(void) {
+  ENTER();
+  sp[0]++;
+  sp[1] = sp[0]; sp++;
+  FETCH();
+  sp[0] &= 63u;
+  *++sp = 2u;
+  CALL(899, w_899, 3590);	/* /mod */
+  sp[-1] += sp[0]; sp--;
+  sp[-1] += sp[0]; sp--;
+  sp[0]++;
+  RETURN();
+}
+
+/* find-name */
+static tbforth_stat w_3601(void) {
+  ENTER();
+  CALL(1462, w_1462, 3602);	/* R1 */
+  STORE(181);
+  CALL(547, w_547, 3604);	/* lwa */
+  FETCH();
+ L3605:
+  sp[1] = sp[0]; sp++;
+  CALL(3582, w_3582, 3607);	/* cfa */
+  CALL(1462, w_1462, 3608);	/* R1 */
+  FETCH();
+  sp[-1] = -(sp[-1] == sp[0]); sp--;
+  if (*sp-- == 0) goto L3616;
+  CALL(3572, w_3572, 3614);	/* name */
+  *++sp = 1u;
+  RETURN();
+ L3616:
+  FETCH();
+  sp[1] = sp[0]; sp++;
+  *++sp = 0u;
+  sp[-1] = -(sp[-1] == sp[0]); sp--;
+  if (*sp-- == 0) goto L3605;
+  sp--;
+  *++sp = 0u;
+  RETURN();
+}
+
+/* profile-reset */
+static tbforth_stat w_3635(void) {
+  ENTER();
+  *++sp = 4294967295u;
+  PRIM(442);	/* (profile) */
+  sp--;
+  RETURN();
+}
+
+/* opstats-reset */
+static tbforth_stat w_3781(void) {
+  ENTER();
+  *++sp = 0u;
+  *++sp = 4294967295u;
+  PRIM(450);	/* (opstats) */
+  sp--;
+  RETURN();
+}
+
+/* op-name */
+static tbforth_stat w_3792(void) {
+  ENTER();
+  CALL(1462, w_1462, 3793);	/* R1 */
+  STORE(181);
+  CALL(547, w_547, 3795);	/* lwa */
+  FETCH();
+ L3796:
+  sp[1] = sp[0]; sp++;
+  sp[0]++;
+  FETCH();
+  sp[0] &= 64u;
+  if (*sp-- == 0) goto L3817;
+  sp[1] = sp[0]; sp++;
+  CALL(3582, w_3582, 3807);	/* cfa */
+  FETCH();
+  CALL(1462, w_1462, 3809);	/* R1 */
+  FETCH();
+  sp[-1] = -(sp[-1] == sp[0]); sp--;
+  if (*sp-- == 0) goto L3817;
+  CALL(3572, w_3572, 3815);	/* name */
+  *++sp = 1u;
+  RETURN();
+ L3817:
+  FETCH();
+  sp[1] = sp[0]; sp++;
+  *++sp = 0u;
+  sp[-1] = -(sp[-1] == sp[0]); sp--;
+  if (*sp-- == 0) goto L3796;
+  sp--;
+  *++sp = 0u;
+  RETURN();
+}
+
+/* TESTS */
+static tbforth_stat w_4026(void) {
+  ENTER();
+  *++sp = 4021u;
+  RETURN();
+}
+
+/* (bench) */
+static tbforth_stat w_4035(void) {
+  ENTER();
+  *++sp = 2147483963u;
+  RETURN();
+}
+
+/* test-do */
+static tbforth_stat w_4078(void) {
+  ENTER();
+  *++sp = 10000000u;
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L4085:
+  sp[1] = rp[0]; sp++;
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L4085;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* test-for */
+static tbforth_stat w_4113(void) {
+  ENTER();
+  *++sp = 10000000u;
+  sp[0]--;
+  *--rp = *sp--;
+ L4118:
+  sp[1] = rp[0]; sp++;
+  sp--;
+  if ((int32_t)--rp[0] >= 0) goto L4118;
+  rp++;
+  RETURN();
+}
+
+/* test-begin-until */
+static tbforth_stat w_4141(void) {
+  ENTER();
+  *++sp = 10000000u;
+  CALL(1462, w_1462, 4145);	/* R1 */
+  STORE(181);
+ L4146:
+  *++sp = 4294967295u;
+  CALL(1462, w_1462, 4148);	/* R1 */
+  CALL(872, w_872, 4149);	/* +! */
+  CALL(1462, w_1462, 4150);	/* R1 */
+  FETCH();
+  sp[0] = -(sp[0] == 0);
+  if (*sp-- == 0) goto L4146;
+  RETURN();
+}
+
+/* test-begin-again */
+static tbforth_stat w_4166(void) {
+  ENTER();
+  *++sp = 10000000u;
+  CALL(1462, w_1462, 4170);	/* R1 */
+  STORE(181);
+ L4171:
+  *++sp = 4294967295u;
+  CALL(1462, w_1462, 4173);	/* R1 */
+  CALL(872, w_872, 4174);	/* +! */
+  CALL(1462, w_1462, 4175);	/* R1 */
+  FETCH();
+  sp[0] = -(sp[0] == 0);
+  if (*sp-- == 0) goto L4181;
+  RETURN();
+ L4181:
+  goto L4171;
+}
+
+/* test-begin-until-stack */
+static tbforth_stat w_4198(void) {
+  ENTER();
+  *++sp = 10000000u;
+ L4201:
+  sp[0]--;
+  sp[1] = -(sp[0] == 0); sp++;
+  if (*sp-- == 0) goto L4201;
+  sp--;
+  RETURN();
+}
+
+/* tail-call */
+static tbforth_stat w_4216(void) {
+  ENTER();
+ L4216:
+  sp[0]--;
+  sp[1] = sp[0]; sp++;
+  sp[0] = -((int32_t)sp[0] > 0);
+  if (*sp-- == 0) goto L4225;
+  goto L4216;
+ L4225:
+  sp--;
+  RETURN();
+}
+
+/* test-tail-call */
+static tbforth_stat w_4236(void) {
+  ENTER();
+  *++sp = 10000000u;
+  CALL(4216, w_4216, 4240);	/* tail-call */
+  RETURN();
+}
+
+/* I */
+static tbforth_stat w_4414(void) {
+  ENTER();
+  *++sp = 2147483964u;
+  RETURN();
+}
+
+/* D */
+static tbforth_stat w_4421(void) {
+  ENTER();
+  *++sp = 2147483965u;
+  RETURN();
+}
+
+/* factor */
+static tbforth_stat w_4430(void) {
+  ENTER();
+  *++sp = 2u;
+  CALL(4421, w_4421, 4432);	/* D */
+  STORE(181);
+  *++sp = 1u;
+  CALL(4414, w_4414, 4435);	/* I */
+  STORE(181);
+  *--rp = *sp--;
+ L4437:
+  CALL(4421, w_4421, 4438);	/* D */
+  FETCH();
+  sp[1] = sp[0]; sp++;
+  sp[-1] *= sp[0]; sp--;
+  sp[1] = rp[0]; sp++;
+  sp[-1] = -((int32_t)sp[-1] > (int32_t)sp[0]); sp--;
+  if (*sp-- == 0) goto L4449;
+  rp++;
+  RETURN();
+ L4449:
+  sp[1] = rp[0]; sp++;
+  CALL(4421, w_4421, 4451);	/* D */
+  FETCH();
+  sp[-1] %= sp[0]; sp--;
+  sp[0] = -(sp[0] == 0);
+  if (*sp-- == 0) goto L4462;
+  rp++;
+  CALL(4421, w_4421, 4460);	/* D */
+  FETCH();
+  RETURN();
+ L4462:
+  CALL(4414, w_4414, 4463);	/* I */
+  FETCH();
+  CALL(4421, w_4421, 4465);	/* D */
+  CALL(872, w_872, 4466);	/* +! */
+  *++sp = 2u;
+  CALL(4414, w_4414, 4468);	/* I */
+  STORE(181);
+  goto L4437;
+}
+
+/* factorial */
+static tbforth_stat w_4480(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  *++sp = 2u;
+  sp[-1] = -((int32_t)sp[-1] > (int32_t)sp[0]); sp--;
+  if (*sp-- == 0) goto L4492;
+  sp[1] = sp[0]; sp++;
+  sp[0]--;
+  CALL(4480, w_4480, 4491);	/* factorial */
+  sp[-1] *= sp[0]; sp--;
+ L4492:
+  RETURN();
+}
+
+/* b64invs */
+static tbforth_stat w_4499(void) {
+  ENTER();
+  *++sp = 4502u;
+  RETURN();
+}
+
+/* b64pt */
+static tbforth_stat w_4587(void) {
+  ENTER();
+  *++sp = 2147483802u;
+  RETURN();
+}
+
+/* b64decode */
+static tbforth_stat w_4598(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  STORE(181);
+  *++sp = 4587u;
+  sp[0]++;
+  CALL(1080, w_1080, 4607);	/* ddict! */
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L4611:
+  sp[1] = sp[0]; sp++;
+  sp[1] = rp[0]; sp++;
+  PRIM(239);	/* +c@ */
+  sp[0] -= 43u;
+  CALL(4499, w_4499, 4620);	/* b64invs */
+  sp[-1] += sp[0]; sp--;
+  FETCH();
+  *++sp = 6u;
+  sp[-1] <<= sp[0]; sp--;
+  sp[1] = sp[-1]; sp++;
+  sp[1] = rp[0]; sp++;
+  sp[0]++;
+  PRIM(239);	/* +c@ */
+  sp[0] -= 43u;
+  CALL(4499, w_4499, 4635);	/* b64invs */
+  sp[-1] += sp[0]; sp--;
+  FETCH();
+  sp[-1] |= sp[0]; sp--;
+  *++sp = 6u;
+  sp[-1] <<= sp[0]; sp--;
+  sp[1] = sp[-1]; sp++;
+  sp[1] = rp[0]; sp++;
+  *++sp = 2u;
+  sp[-1] += sp[0]; sp--;
+  PRIM(239);	/* +c@ */
+  sp[1] = sp[0]; sp++;
+  sp[0] = -(sp[0] == 61u);
+  if (*sp-- == 0) goto L4659;
+  sp--;
+  goto L4666;
+ L4659:
+  sp[0] -= 43u;
+  CALL(4499, w_4499, 4663);	/* b64invs */
+  sp[-1] += sp[0]; sp--;
+  FETCH();
+  sp[-1] |= sp[0]; sp--;
+ L4666:
+  *++sp = 6u;
+  sp[-1] <<= sp[0]; sp--;
+  sp[1] = sp[-1]; sp++;
+  sp[1] = rp[0]; sp++;
+  sp[0] += 3u;
+  PRIM(239);	/* +c@ */
+  sp[1] = sp[0]; sp++;
+  sp[0] = -(sp[0] == 61u);
+  if (*sp-- == 0) goto L4688;
+  sp--;
+  goto L4695;
+ L4688:
+  sp[0] -= 43u;
+  CALL(4499, w_4499, 4692);	/* b64invs */
+  sp[-1] += sp[0]; sp--;
+  FETCH();
+  sp[-1] |= sp[0]; sp--;
+ L4695:
+  sp[1] = sp[0]; sp++;
+  *++sp = 16u;
+  sp[-1] >>= sp[0]; sp--;
+  sp[0] &= 255u;
+  CALL(4587, w_4587, 4703);	/* b64pt */
+  PRIM(234);	/* c!+ */
+  sp[1] = sp[-1]; sp++;
+  sp[1] = rp[0]; sp++;
+  *++sp = 2u;
+  sp[-1] += sp[0]; sp--;
+  PRIM(239);	/* +c@ */
+  sp[0] = -(sp[0] == 61u);
+  CALL(816, w_816, 4715);	/* not */
+  if (*sp-- == 0) goto L4727;
+  sp[1] = sp[0]; sp++;
+  *++sp = 8u;
+  sp[-1] >>= sp[0]; sp--;
+  sp[0] &= 255u;
+  CALL(4587, w_4587, 4726);	/* b64pt */
+  PRIM(234);	/* c!+ */
+ L4727:
+  sp[1] = sp[-1]; sp++;
+  sp[1] = rp[0]; sp++;
+  sp[0] += 3u;
+  PRIM(239);	/* +c@ */
+  sp[0] = -(sp[0] == 61u);
+  CALL(816, w_816, 4739);	/* not */
+  if (*sp-- == 0) goto L4748;
+  sp[1] = sp[0]; sp++;
+  sp[0] &= 255u;
+  CALL(4587, w_4587, 4747);	/* b64pt */
+  PRIM(234);	/* c!+ */
+ L4748:
+  sp--;
+  *++sp = 4u;
+  if ((int32_t)(rp[0] += *sp--) < (int32_t)rp[1]) goto L4611;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  sp--;
+  RETURN();
+}
+
+/* bitsbuff */
+static tbforth_stat w_4774(void) {
+  ENTER();
+  *++sp = 2147483966u;
+  RETURN();
+}
+
+/* b64len */
+static tbforth_stat w_4783(void) {
+  ENTER();
+  *++sp = 2147483967u;
+  RETURN();
+}
+
+/* alphabase */
+static tbforth_stat w_4794(void) {
+  ENTER();
+  sp[0] &= 63u;
+  *++sp = 4802u;
+  goto L4835;
+ L4835:
+  sp[0]++;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  PRIM(239);	/* +c@ */
+  RETURN();
+}
+
+/* storecode */
+static tbforth_stat w_4846(void) {
+  ENTER();
+  if (*sp-- == 0) goto L4855;
+  sp--;
+  *++sp = 61u;
+  goto L4856;
+ L4855:
+  CALL(4794, w_4794, 4856);	/* alphabase */
+ L4856:
+  CALL(4587, w_4587, 4857);	/* b64pt */
+  PRIM(234);	/* c!+ */
+  RETURN();
+}
+
+/* 3bytesin */
+static tbforth_stat w_4865(void) {
+  ENTER();
+  *++sp = 0u;
+  CALL(4774, w_4774, 4867);	/* bitsbuff */
+  STORE(181);
+  *++sp = 3u;
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L4874:
+  sp[1] = sp[-1]; sp++;
+  sp[1] = sp[-1]; sp++;
+  sp[1] = rp[0]; sp++;
+  sp[-1] += sp[0]; sp--;
+  PRIM(239);	/* +c@ */
+  CALL(4774, w_4774, 4882);	/* bitsbuff */
+  FETCH();
+  *++sp = 8u;
+  sp[-1] <<= sp[0]; sp--;
+  sp[-1] += sp[0]; sp--;
+  CALL(4774, w_4774, 4888);	/* bitsbuff */
+  STORE(181);
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L4874;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  CALL(4783, w_4783, 4907);	/* b64len */
+  FETCH();
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  sp[-1] -= sp[0]; sp--;
+  RETURN();
+}
+
+/* 4chars! */
+static tbforth_stat w_4917(void) {
+  ENTER();
+  *++sp = 4u;
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L4923:
+  sp[1] = sp[0]; sp++;
+  sp[1] = rp[0]; sp++;
+  sp[-1] -= sp[0]; sp--;
+  *++sp = 0u;
+  sp[-1] = -((int32_t)sp[-1] < (int32_t)sp[0]); sp--;
+  CALL(4774, w_4774, 4931);	/* bitsbuff */
+  FETCH();
+  *++sp = 18u;
+  sp[-1] >>= sp[0]; sp--;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  CALL(4846, w_4846, 4937);	/* storecode */
+  CALL(4774, w_4774, 4938);	/* bitsbuff */
+  FETCH();
+  *++sp = 6u;
+  sp[-1] <<= sp[0]; sp--;
+  CALL(4774, w_4774, 4943);	/* bitsbuff */
+  STORE(181);
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L4923;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  sp--;
+  RETURN();
+}
+
+/* b64encode */
+static tbforth_stat w_4970(void) {
+  ENTER();
+  *++sp = 4587u;
+  sp[0]++;
+  CALL(1080, w_1080, 4975);	/* ddict! */
+  *++sp = 0u;
+  CALL(4587, w_4587, 4977);	/* b64pt */
+  STORE(181);
+  sp[1] = sp[0]; sp++;
+  CALL(4783, w_4783, 4980);	/* b64len */
+  STORE(181);
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L4985:
+  sp[1] = rp[0]; sp++;
+  CALL(4865, w_4865, 4989);	/* 3bytesin */
+  CALL(4917, w_4917, 4990);	/* 4chars! */
+  *++sp = 3u;
+  if ((int32_t)(rp[0] += *sp--) < (int32_t)rp[1]) goto L4985;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  sp--;
+  RETURN();
+}
+
+/* make-task */
+static tbforth_stat w_5049(void) {
+  ENTER();
+  *--rp = *sp--;
+  *--rp = *sp--;
+  sp[1] = sp[-1]; sp++;
+  sp[1] = sp[-1]; sp++;
+  *++sp = *rp++;
+  sp[-1] += sp[0]; sp--;
+  sp[-1] += sp[0]; sp--;
+  sp[0] += 6u;
+  sp[1] = sp[0]; sp++;
+  CALL(1415, w_1415, 5061);	/* allot */
+  sp[1] = rp[0]; sp++;
+  STORE(181);
+  sp[1] = rp[0]; sp++;
+  sp[0] += 5u;
+  STORE(181);
+  *++sp = *rp++;
+  sp[0] += 6u;
+  STORE(181);
+  RETURN();
+}
+
+/* tsk1 */
+static tbforth_stat w_5206(void) {
+  ENTER();
+  *++sp = 2147483968u;
+  RETURN();
+}
+
+/* tsk2 */
+static tbforth_stat w_5214(void) {
+  ENTER();
+  *++sp = 2147484085u;
+  RETURN();
+}
+
+/* tsk3 */
+static tbforth_stat w_5222(void) {
+  ENTER();
+  *++sp = 2147484202u;
+  RETURN();
+}
+
+/* box */
+static tbforth_stat w_5347(void) {
+  ENTER();
+  *++sp = 2147484231u;
+  RETURN();
+}
+
+/* test-do-no-task */
+static tbforth_stat w_5554(void) {
+  ENTER();
+  *++sp = 10000000u;
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L5561:
+  sp[1] = rp[0]; sp++;
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L5561;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* bench-for */
+static tbforth_stat w_5984(void) {
+  ENTER();
+  sp[0]--;
+  *--rp = *sp--;
+ L5986:
+  sp[1] = rp[0]; sp++;
+  sp--;
+  if ((int32_t)--rp[0] >= 0) goto L5986;
+  rp++;
+  RETURN();
+}
+
+/* bench-do */
+static tbforth_stat w_6005(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6009:
+  sp[1] = rp[0]; sp++;
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6009;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* bench-until */
+static tbforth_stat w_6039(void) {
+  ENTER();
+ L6039:
+  sp[0]--;
+  sp[1] = -(sp[0] == 0); sp++;
+  if (*sp-- == 0) goto L6039;
+  sp--;
+  RETURN();
+}
+
+/* bench-tail */
+static tbforth_stat w_6054(void) {
+  ENTER();
+ L6054:
+  sp[0]--;
+  sp[1] = sp[0]; sp++;
+  sp[0] = -((int32_t)sp[0] > 0);
+  if (*sp-- == 0) goto L6063;
+  goto L6054;
+ L6063:
+  sp--;
+  RETURN();
+}
+
+/* fib */
+static tbforth_stat w_6069(void) {
+  ENTER();
+  sp[1] = sp[0]; sp++;
+  *++sp = 2u;
+  sp[-1] = -((int32_t)sp[-1] < (int32_t)sp[0]); sp--;
+  if (*sp-- == 0) goto L6076;
+  RETURN();
+ L6076:
+  sp[1] = sp[0]; sp++;
+  sp[0]--;
+  CALL(6069, w_6069, 6081);	/* fib */
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *++sp = 2u;
+  sp[-1] -= sp[0]; sp--;
+  CALL(6069, w_6069, 6087);	/* fib */
+  sp[-1] += sp[0]; sp--;
+  RETURN();
+}
+
+/* bench-fib */
+static tbforth_stat w_6096(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6100:
+  *++sp = 20u;
+  CALL(6069, w_6069, 6103);	/* fib */
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6100;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* bench-factorial */
+static tbforth_stat w_6132(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6136:
+  *++sp = 12u;
+  CALL(4480, w_4480, 6139);	/* factorial */
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6136;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* bench-factor */
+static tbforth_stat w_6166(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6170:
+  *++sp = 10007u;
+  CALL(4430, w_4430, 6173);	/* factor */
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6170;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* bench-text */
+static tbforth_stat w_6198(void) {
+  ENTER();
+  *++sp = 6201u;
+  RETURN();
+}
+
+/* bench-buf */
+static tbforth_stat w_6240(void) {
+  ENTER();
+  *++sp = 2147484232u;
+  RETURN();
+}
+
+/* bench-bcopy */
+static tbforth_stat w_6252(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6256:
+  CALL(6198, w_6198, 6257);	/* bench-text */
+  *++sp = 2u;
+  CALL(6240, w_6240, 6259);	/* bench-buf */
+  *++sp = 0u;
+  *++sp = 60u;
+  PRIM(310);	/* bcopy */
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6256;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* bench-bstr= */
+static tbforth_stat w_6289(void) {
+  ENTER();
+  CALL(6198, w_6198, 6290);	/* bench-text */
+  *++sp = 2u;
+  CALL(6240, w_6240, 6292);	/* bench-buf */
+  *++sp = 0u;
+  *++sp = 60u;
+  PRIM(310);	/* bcopy */
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6300:
+  CALL(6198, w_6198, 6301);	/* bench-text */
+  *++sp = 2u;
+  CALL(6240, w_6240, 6303);	/* bench-buf */
+  *++sp = 0u;
+  *++sp = 60u;
+  PRIM(316);	/* bstr= */
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6300;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* name>ram */
+static tbforth_stat w_6332(void) {
+  ENTER();
+  *--rp = *sp--;
+  PRIM(254);	/* next-word */
+  *++sp = 0u;
+  *++sp = *rp++;
+  *++sp = 0u;
+  *++sp = 20u;
+  PRIM(310);	/* bcopy */
+  RETURN();
+}
+
+/* fname1 */
+static tbforth_stat w_6346(void) {
+  ENTER();
+  *++sp = 2147484253u;
+  RETURN();
+}
+
+/* fname2 */
+static tbforth_stat w_6355(void) {
+  ENTER();
+  *++sp = 2147484258u;
+  RETURN();
+}
+
+/* fname3 */
+static tbforth_stat w_6364(void) {
+  ENTER();
+  *++sp = 2147484263u;
+  RETURN();
+}
+
+/* fname4 */
+static tbforth_stat w_6373(void) {
+  ENTER();
+  *++sp = 2147484268u;
+  RETURN();
+}
+
+/* bench-find */
+static tbforth_stat w_6384(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6388:
+  CALL(6346, w_6346, 6389);	/* fname1 */
+  PRIM(293);	/* (find) */
+  sp--;
+  sp--;
+  CALL(6355, w_6355, 6393);	/* fname2 */
+  PRIM(293);	/* (find) */
+  sp--;
+  sp--;
+  CALL(6364, w_6364, 6397);	/* fname3 */
+  PRIM(293);	/* (find) */
+  sp--;
+  sp--;
+  CALL(6373, w_6373, 6401);	/* fname4 */
+  PRIM(293);	/* (find) */
+  sp--;
+  sp--;
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6388;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* b64-buf */
+static tbforth_stat w_6428(void) {
+  ENTER();
+  *++sp = 2147484273u;
+  RETURN();
+}
+
+/* bench-b64 */
+static tbforth_stat w_6439(void) {
+  ENTER();
+  *++sp = 0u;
+  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;
+  *--rp = *sp--;
+  *--rp = *sp--;
+ L6443:
+  CALL(6198, w_6198, 6444);	/* bench-text */
+  CALL(2245, w_2245, 6445);	/* count */
+  CALL(1455, w_1455, 6446);	/* pad */
+  CALL(4970, w_4970, 6447);	/* b64encode */
+  CALL(1455, w_1455, 6448);	/* pad */
+  CALL(2245, w_2245, 6449);	/* count */
+  CALL(6428, w_6428, 6450);	/* b64-buf */
+  CALL(4598, w_4598, 6451);	/* b64decode */
+  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L6443;
+  *++sp = *rp++;
+  rp++;
+  sp--;
+  RETURN();
+}
+
+/* tasks-left */
+static tbforth_stat w_6476(void) {
+  ENTER();
+  *++sp = 2147484314u;
+  RETURN();
+}
+
+/* bench-n */
+static tbforth_stat w_6486(void) {
+  ENTER();
+  *++sp = 2147484315u;
+  RETURN();
+}
+
+const struct tbforth_native tbforth_natives[] = {
+  { 454, 464, 68, 0x6f65f8f7u, w_454 },
+  { 467, 477, 40, 0x774a94edu, w_467 },
+  { 480, 491, 40, 0x6e8a7671u, w_480 },
+  { 496, 499, 1, 0x706c9ffeu, w_496 },
+  { 504, 506, 85, 0x1c0c8154u, w_504 },
+  { 512, 515, 83, 0x74f27224u, w_512 },
+  { 521, 524, 84, 0x74f27224u, w_521 },
+  { 532, 535, 85, 0x74f27224u, w_532 },
+  { 540, 543, 1, 0x30790731u, w_540 },
+  { 547, 550, 1, 0x706c9ffeu, w_547 },
+  { 557, 561, 1, 0x75ab54bdu, w_557 },
+  { 566, 571, 83, 0xa8d53459u, w_566 },
+  { 579, 585, 83, 0x276ddc07u, w_579 },
+  { 593, 599, 84, 0x276ddc07u, w_593 },
+  { 606, 610, 566, 0x3721868du, w_606 },
+  { 620, 625, 85, 0xecd7ddfcu, w_620 },
+  { 631, 636, 84, 0xa8d53459u, w_631 },
+  { 641, 646, 12, 0xb844ae14u, w_641 },
+  { 653, 658, 12, 0xf67ad02du, w_653 },
+  { 665, 670, 12, 0x89a2df02u, w_665 },
+  { 674, 679, 12, 0x10cadaf3u, w_674 },
+  { 684, 689, 12, 0xe3f34e88u, w_684 },
+  { 696, 701, 7, 0x42829f92u, w_696 },
+  { 705, 709, 7, 0x2a2deeb6u, w_705 },
+  { 716, 720, 7, 0x8613105cu, w_716 },
+  { 724, 730, 7, 0x2160e464u, w_724 },
+  { 734, 740, 7, 0xb6eb02ffu, w_734 },
+  { 745, 751, 7, 0x0e27401au, w_745 },
+  { 756, 762, 7, 0xe11d88e5u, w_756 },
+  { 766, 771, 7, 0xe3f34e88u, w_766 },
+  { 775, 779, 766, 0x8147b098u, w_775 },
+  { 782, 787, 766, 0x4822c705u, w_782 },
+  { 790, 795, 766, 0x3d620594u, w_790 },
+  { 800, 804, 724, 0x2a2deeb6u, w_800 },
+  { 809, 812, 86, 0x349b9fbfu, w_809 },
+  { 816, 818, 30, 0x1c0c8154u, w_816 },
+  { 821, 824, 85, 0xb882d7a5u, w_821 },
+  { 827, 830, 85, 0x349b9fbfu, w_827 },
+  { 833, 836, 85, 0xb4a32504u, w_833 },
+  { 840, 843, 37, 0x2cb9a83bu, w_840 },
+  { 848, 851, 34, 0x34cafdf4u, w_848 },
+  { 855, 859, 37, 0xaffa779eu, w_855 },
+  { 864, 869, 38, 0x80791855u, w_864 },
+  { 872, 879, 35, 0x24ce80d2u, w_872 },
+  { 883, 887, 84, 0x35ca4188u, w_883 },
+  { 891, 895, 86, 0x35ca4188u, w_891 },
+  { 899, 906, 37, 0x86597980u, w_899 },
+  { 914, 917, 62, 0x34cafdf4u, w_914 },
+  { 925, 929, 62, 0x3698762eu, w_925 },
+  { 932, 935, 39, 0xede2f043u, w_932 },
+  { 939, 945, 39, 0x0e0f167bu, w_939 },
+  { 948, 951, 39, 0xb5e05984u, w_948 },
+  { 955, 961, 39, 0x39d555f6u, w_955 },
+  { 967, 971, 39, 0xd6743911u, w_967 },
+  { 978, 983, 939, 0x58913c33u, w_978 },
+  { 988, 999, 68, 0x6af49d00u, w_988 },
+  { 1005, 1015, 68, 0xe3c5358bu, w_1005 },
+  { 1021, 1030, 68, 0x51c39a79u, w_1021 },
+  { 1036, 1041, 3, 0xd728c5c3u, w_1036 },
+  { 1046, 1050, 1, 0x4f1e4c28u, w_1046 },
+  { 1055, 1059, 1, 0xaa4185a7u, w_1055 },
+  { 1064, 1075, 35, 0xed985ef6u, w_1064 },
+  { 1080, 1094, 37, 0xe09977a6u, w_1080 },
+  { 1097, 1107, 1, 0xcb985cc3u, w_1097 },
+  { 1111, 1127, 11, 0xa1da553eu, w_1111 },
+  { 1131, 1135, 11, 0xb26e585bu, w_1131 },
+  { 1139, 1143, 1, 0x9ec94d35u, w_1139 },
+  { 1147, 1155, 1, 0x2226a9bau, w_1147 },
+  { 1159, 1188, 1, 0x5d4d8879u, w_1159 },
+  { 1191, 1202, 1, 0xf9018e51u, w_1191 },
+  { 1205, 1214, 1, 0xea1c3595u, w_1205 },
+  { 1217, 1226, 1, 0x2caf1af7u, w_1217 },
+  { 1233, 1237, 3, 0x35a50634u, w_1233 },
+  { 1242, 1254, 1, 0xcc4fd8b8u, w_1242 },
+  { 1259, 1316, 1, 0x7ba2fa69u, w_1259 },
+  { 1320, 1327, 1, 0xb1b1dda0u, w_1320 },
+  { 1332, 1345, 1, 0x444f6d43u, w_1332 },
+  { 1350, 1352, 11, 0x1c0c8154u, w_1350 },
+  { 1357, 1365, 1, 0xf6528206u, w_1357 },
+  { 1370, 1380, 1, 0xcb985cc3u, w_1370 },
+  { 1385, 1397, 1, 0x6908800fu, w_1385 },
+  { 1402, 1410, 1, 0x5175bb85u, w_1402 },
+  { 1415, 1439, 83, 0xde596318u, w_1415 },
+  { 1446, 1451, 496, 0x825b80dbu, w_1446 },
+  { 1455, 1459, 3, 0xfd081632u, w_1455 },
+  { 1462, 1466, 3, 0xf1a25c91u, w_1462 },
+  { 1470, 1494, 1462, 0xda8ead7cu, w_1470 },
+  { 2168, 2172, 3, 0xb99fc5d2u, w_2168 },
+  { 2176, 2183, 83, 0xf4f05d08u, w_2176 },
+  { 2186, 2194, 1, 0x17836b64u, w_2186 },
+  { 2199, 2203, 2168, 0xe5972062u, w_2199 },
+  { 2209, 2240, 2168, 0x228bb557u, w_2209 },
+  { 2245, 2251, 35, 0x383818e9u, w_2245 },
+  { 2264, 2269, 1, 0xdd2dc186u, w_2264 },
+  { 2275, 2280, 1, 0xb7f91034u, w_2275 },
+  { 2285, 2289, 85, 0x45a8d01cu, w_2285 },
+  { 2293, 2298, 35, 0x150a3792u, w_2293 },
+  { 2302, 2315, 37, 0xb3a19205u, w_2302 },
+  { 2319, 2332, 37, 0xe86d01ceu, w_2319 },
+  { 2336, 2345, 1, 0x1538dd0du, w_2336 },
+  { 2350, 2360, 1, 0x50294401u, w_2350 },
+  { 2365, 2373, 68, 0xaabab250u, w_2365 },
+  { 2376, 2394, 606, 0x96bc03a5u, w_2376 },
+  { 2412, 2423, 1, 0x181220a5u, w_2412 },
+  { 2445, 2461, 606, 0x70025bc0u, w_2445 },
+  { 2464, 2476, 606, 0x4f0f3feeu, w_2464 },
+  { 2712, 2731, 547, 0x054ecf20u, w_2712 },
+  { 2736, 2749, 68, 0x17f8b217u, w_2736 },
+  { 2753, 2757, 36, 0x98af1496u, w_2753 },
+  { 2763, 2779, 1, 0x755a120au, w_2763 },
+  { 2786, 2816, 2245, 0x4bff4aa9u, w_2786 },
+  { 2820, 2827, 99, 0x9aba3e8bu, w_2820 },
+  { 2836, 2843, 35, 0x948b0e22u, w_2836 },
+  { 2852, 2859, 35, 0xdade3b62u, w_2852 },
+  { 2866, 2873, 35, 0x3a7e1da2u, w_2866 },
+  { 2883, 2905, 606, 0x1db45c6cu, w_2883 },
+  { 2909, 2919, 11, 0xc4b2e986u, w_2909 },
+  { 2984, 2988, 3, 0x51b102bcu, w_2984 },
+  { 3065, 3070, 2445, 0xacab269fu, w_3065 },
+  { 3150, 3155, 939, 0x075d198bu, w_3150 },
+  { 3513, 3520, 58, 0xc0b01274u, w_3513 },
+  { 3572, 3578, 13, 0xae6059e5u, w_3572 },
+  { 3582, 3594, 13, 0x8a37ab8eu, w_3582 },
+  { 3601, 3626, 1462, 0x267b1124u, w_3601 },
+  { 3635, 3639, 86, 0xeab9a3cau, w_3635 },
+  { 3781, 3786, 83, 0x0d7ed5e5u, w_3781 },
+  { 3792, 3827, 1462, 0xca82dabbu, w_3792 },
+  { 4026, 4029, 1, 0x506164ebu, w_4026 },
+  { 4035, 4039, 3, 0xb59d80efu, w_4035 },
+  { 4078, 4107, 3, 0x1ffa727du, w_4078 },
+  { 4113, 4131, 3, 0xe5356cd5u, w_4113 },
+  { 4141, 4156, 3, 0x7b34c7b8u, w_4141 },
+  { 4166, 4184, 3, 0x1c7b2753u, w_4166 },
+  { 4198, 4209, 3, 0xae1d0b77u, w_4198 },
+  { 4216, 4227, 14, 0xdc471ee7u, w_4216 },
+  { 4236, 4241, 3, 0x5f8108dau, w_4236 },
+  { 4414, 4418, 3, 0x6d9ad100u, w_4414 },
+  { 4421, 4425, 3, 0x7998a54du, w_4421 },
+  { 4430, 4472, 85, 0x38334e7au, w_4430 },
+  { 4480, 4493, 35, 0xd718fbc1u, w_4480 },
+  { 4499, 4502, 1, 0x013b2710u, w_4499 },
+  { 4587, 4591, 3, 0xfd081632u, w_4587 },
+  { 4598, 4768, 35, 0x7e089e32u, w_4598 },
+  { 4774, 4778, 3, 0x3195f55eu, w_4774 },
+  { 4783, 4787, 3, 0x2d93b07bu, w_4783 },
+  { 4794, 4839, 94, 0x488193d4u, w_4794 },
+  { 4846, 4859, 90, 0xd86c684fu, w_4846 },
+  { 4865, 4911, 83, 0xfb36d7b1u, w_4865 },
+  { 4917, 4963, 1, 0x9d5136cfu, w_4917 },
+  { 4970, 5009, 3, 0xe085a7dcu, w_4970 },
+  { 5049, 5074, 48, 0x2455dac1u, w_5049 },
+  { 5206, 5210, 3, 0x762fb3fcu, w_5206 },
+  { 5214, 5218, 3, 0x7ae96185u, w_5214 },
+  { 5222, 5226, 3, 0x4136d9c2u, w_5222 },
+  { 5347, 5351, 3, 0x758d9943u, w_5347 },
+  { 5554, 5583, 3, 0xc1026f39u, w_5554 },
+  { 5984, 5999, 14, 0xd4692e2du, w_5984 },
+  { 6005, 6031, 83, 0x5b643b54u, w_6005 },
+  { 6039, 6047, 14, 0x2405026du, w_6039 },
+  { 6054, 6065, 14, 0x429333a7u, w_6054 },
+  { 6069, 6089, 35, 0xef55cde0u, w_6069 },
+  { 6096, 6122, 83, 0x414a18cdu, w_6096 },
+  { 6132, 6158, 83, 0x5d837ce4u, w_6132 },
+  { 6166, 6191, 83, 0xeb7cfe25u, w_6166 },
+  { 6198, 6201, 1, 0xf9850157u, w_6198 },
+  { 6240, 6244, 3, 0x3d8b0284u, w_6240 },
+  { 6252, 6281, 83, 0xc5e1a240u, w_6252 },
+  { 6289, 6326, 6198, 0xe0c3fe05u, w_6289 },
+  { 6332, 6341, 48, 0x6a3b4497u, w_6332 },
+  { 6346, 6350, 3, 0x41572d6du, w_6346 },
+  { 6355, 6359, 3, 0x01e9607au, w_6355 },
+  { 6364, 6368, 3, 0x35dce663u, w_6364 },
+  { 6373, 6377, 3, 0x75d07f30u, w_6373 },
+  { 6384, 6422, 83, 0x1587f27bu, w_6384 },
+  { 6428, 6432, 3, 0xb9c41e49u, w_6428 },
+  { 6439, 6469, 83, 0x00db6d24u, w_6439 },
+  { 6476, 6480, 3, 0x01fce832u, w_6476 },
+  { 6486, 6490, 3, 0xfdfaa34fu, w_6486 },
+};
+const uint16_t tbforth_nnatives = 178;
@@ -152,6 +152,8 @@
 \	* (find) ( a u - h c) - Find head & code of word definition for counted word string at a 
 \	* ; ( - ) - terminate a word definition (go out of compile state)
 \	* immediate - mark last compiled word as "immediate"
+\	* inline - compile calls of the last word as a copy of its body (which
+\	  must be straight line code; is/to no longer reach the copies)
 \	* (allot1) - allocate 1 RCELL in RAM
 \	* bcopy -
 \	* bstr= -
@@ -203,9 +205,9 @@
 
 \ Stack manipulation
 \
-: 2dup ( x y - x y x y)  over over ;
-: 2drop ( x y - ) drop drop ;
-: nip ( x y - y) over xor xor ;
+: 2dup ( x y - x y x y)  over over ; inline
+: 2drop ( x y - ) drop drop ; inline
+: nip ( x y - y) over xor xor ; inline
 : 2swap ( x1 y1 x2 y2 - x2 y2 x1 y1) rot >r rot r> ;
 
 \ Misc useful stuff
@@ -478,3 +480,11 @@ variable R1
 \
 : [ reset-state ; immediate
 : ] is-compiling ;
+
+\ ** Tasks
+\
+\ Park the running task (see tasks.f) until fd can be read or written,
+\ letting the others run meanwhile.
+\
+: wait-readable ( fd -- )  1 (wait-fd) yield ;
+: wait-writable ( fd -- )  2 (wait-fd) yield ;
@@ -16,6 +16,9 @@ variable tcp-addr 2 allot
 : mq-wait-ms ( ms - c | -1)
     mq-fd @ 1 rot poll ;
 
+\ Let the other tasks run until the broker has something for us.
+: mq-wait ( - )  mq-fd @ wait-readable ;
+
 : mq-write-rmlen ( n - )
     R1 !
     begin
@@ -31,6 +34,7 @@ variable tcp-addr 2 allot
 variable pklen
 variable mult
 : (mq-read-fixed-hdr)  ( -- len flags type | -1)
+    mq-wait
     mq-rb dup 0> if
 	pkt-flags 
 	1 mult !
@@ -0,0 +1,62 @@
+\ Writing into a word that runs as native code puts it back to being
+\ interpreted. Run with a low JIT threshold (make check-jit) so each
+\ loop below is compiled before the words it calls are written into.
+
+: expect ( n n' - )
+  2dup = if 2drop exit then
+  ." FAIL: got " swap . ." expected " . cr abort ;
+
+: warm ( xt - n ) dup exec drop dup exec drop exec ;
+
+\ to (ddict!), interpreted and compiled
+5 value five
+: g five five + ;
+: lp 0 300 0 do g + loop ;
+' lp warm 3000 expect
+10 to five
+' lp warm 6000 expect
+: to-20 20 to five ;
+to-20
+' lp warm 12000 expect
+
+\ is (!): h's first cell, the 1, becomes a call to h7
+: h 1 2 + 0 + 0 + 0 + ;
+: lp2 0 300 0 do h + loop ;
+' lp2 warm 900 expect
+: h7 7 ;
+' h7 is h
+' lp2 warm 2700 expect
+
+\ The byte writes below turn the + of "1 2 +" into the - of h-
+: h- 1 2 - 0 + 0 + 0 + ;
+: minus ( - c ) ['] h- 2 + @ ;
+
+\ (c!) through the A register
+: h1 1 2 + 0 + 0 + 0 + ;
+: lp3 0 300 0 do h1 + loop ;
+' lp3 warm 900 expect
+' h1 2 + A! minus (c!)
+' lp3 warm -300 expect
+
+\ +c!
+: h2 1 2 + 0 + 0 + 0 + ;
+: lp4 0 300 0 do h2 + loop ;
+' lp4 warm 900 expect
+minus ' h2 4 +c!
+' lp4 warm -300 expect
+
+\ bcopy
+: h3 1 2 + 0 + 0 + 0 + ;
+: lp5 0 300 0 do h3 + loop ;
+' lp5 warm 900 expect
+' h- 0 ' h3 0 12 bcopy
+' lp5 warm -300 expect
+
+\ , into a rewound here
+: h4 1 2 + 0 + 0 + 0 + ;
+: lp6 0 300 0 do h4 + loop ;
+' lp6 warm 900 expect
+here ' h4 2 + (here) !  minus ,  (here) !
+' lp6 warm -300 expect
+
+." jit tests passed" cr
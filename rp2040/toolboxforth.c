@@ -5,9 +5,10 @@
 #include <hardware/spi.h>
 #include <hardware/flash.h>
 #include <hardware/sync.h>
+#include <hardware/clocks.h>
 #include "../tbforth.h"
 
-struct dict *dict;
+TBFORTH_TLS struct dict *dict;
 
 #define DICT_SECTORS ((sizeof (struct dict) / FLASH_SECTOR_SIZE) + 1)
 // #define TOP_OF_DICT ((XIP_BASE + PICO_FLASH_SIZE_BYTES) - (DICT_SECTORS * FLASH_SECTOR_SIZE))
@@ -15,34 +16,93 @@ struct dict *dict;
 #define TOP_OF_DICT_SECT (256*1024)
 #define TOP_OF_DICT (XIP_BASE + TOP_OF_DICT_SECT)
 
+// Words translated to C (tbforth.img.c, see CMakeLists.txt) are taken out
+// of the dictionary while it is saved.
+//
+#ifdef TBFORTH_NATIVE
+# define NATIVE_OFF() tbforth_native_remove()
+# define NATIVE_ON() tbforth_native_install(tbforth_natives, tbforth_nnatives)
+#else
+# define NATIVE_OFF()
+# define NATIVE_ON()
+#endif
+
 void save_image (void) {
   //  printf("Saving: %d bytes (%d sectors) to addr 0x%08lX (sector 0x%04X)\n",
   //	 sizeof (struct dict), DICT_SECTORS, TOP_OF_DICT, TOP_OF_DICT_SECT);
+  NATIVE_OFF();
   int32_t ints = save_and_disable_interrupts();
   flash_range_erase (TOP_OF_DICT_SECT, DICT_SECTORS * FLASH_SECTOR_SIZE);
 
   flash_range_program (TOP_OF_DICT_SECT, (uint8_t*) dict,
 		       ((sizeof (struct dict) / FLASH_PAGE_SIZE)+1) * FLASH_PAGE_SIZE);
   restore_interrupts(ints);
+  NATIVE_ON();
 }
 
 int load_image (void) {
   memcpy (dict, (uint8_t*)TOP_OF_DICT, sizeof (struct dict));
 }
 
+/*
+  Snapshots (dict + RAM + scheduler) live in the sectors after the image:
+  a header sector, then the dict, then RAM. There's only the one, so
+  save-snapshot and load-snapshot take no file name here.
+*/
+#define SNAP_SECT (TOP_OF_DICT_SECT + DICT_SECTORS * FLASH_SECTOR_SIZE)
+#define SNAP_DICT_SECT (SNAP_SECT + FLASH_SECTOR_SIZE)
+#define SNAP_RAM_SECT (SNAP_DICT_SECT + DICT_SECTORS * FLASH_SECTOR_SIZE)
+#define SNAP_RAM_SECTORS ((SNAPSHOT_RAM_BYTES / FLASH_SECTOR_SIZE) + 1)
+#define SNAP ((struct tbforth_snapshot*)(XIP_BASE + SNAP_SECT))
+
+void save_snapshot (void) {
+  static union {
+    struct tbforth_snapshot s;
+    uint8_t page[((sizeof (struct tbforth_snapshot) / FLASH_PAGE_SIZE)+1) *
+		 FLASH_PAGE_SIZE];
+  } hdr;
+  NATIVE_OFF();
+  tbforth_snapshot_header(&hdr.s);
+  int32_t ints = save_and_disable_interrupts();
+  flash_range_erase (SNAP_SECT, (1 + DICT_SECTORS + SNAP_RAM_SECTORS) *
+		     FLASH_SECTOR_SIZE);
+  flash_range_program (SNAP_SECT, hdr.page, sizeof (hdr.page));
+  flash_range_program (SNAP_DICT_SECT, (uint8_t*) dict,
+		       ((sizeof (struct dict) / FLASH_PAGE_SIZE)+1) * FLASH_PAGE_SIZE);
+  flash_range_program (SNAP_RAM_SECT, (uint8_t*) tbforth_ram,
+		       ((SNAPSHOT_RAM_BYTES / FLASH_PAGE_SIZE)+1) * FLASH_PAGE_SIZE);
+  restore_interrupts(ints);
+  NATIVE_ON();
+}
+
+/* Checked in place (XIP), then copied in */
+int load_snapshot (void) {
+  struct tbforth_snapshot s = *SNAP;
+  if (!tbforth_snapshot_check(&s, (struct dict*)(XIP_BASE + SNAP_DICT_SECT),
+			      (RAMC*)(XIP_BASE + SNAP_RAM_SECT)))
+    return 0;
+  memcpy (dict, (uint8_t*)(XIP_BASE + SNAP_DICT_SECT), s.img.size);
+  memcpy (tbforth_ram, (uint8_t*)(XIP_BASE + SNAP_RAM_SECT), SNAPSHOT_RAM_BYTES);
+  tbforth_snapshot_restore(&s);
+  NATIVE_ON();
+  return 1;
+}
+
 
 uint8_t rxc(void) {
+  fflush(stdout);
   return getc(stdin);
 }
 
+/* Flushed a line at a time, before reading, when idle (or on flush) */
 void txc(uint8_t c) {
   fputc(c, stdout);
-  fflush(stdout);
+  if (c == '\n') fflush(stdout);
 }
 
 void txs(char* s, int cnt) {
   fwrite(s,cnt,1,stdout);
-  fflush(stdout);
+  if (memchr(s, '\n', cnt)) fflush(stdout);
 }
 #define txs0(s) txs(s,strlen(s))
 
@@ -174,6 +234,7 @@ tbforth_stat c_handle(void) {
     {
       int32_t ints = save_and_disable_interrupts();
       flash_range_erase (TOP_OF_DICT_SECT, 1);
+      flash_range_erase (SNAP_SECT, FLASH_SECTOR_SIZE);
       restore_interrupts(ints);
     }
   case MCU_RESTART:
@@ -190,18 +251,50 @@ tbforth_stat c_handle(void) {
       dpush(ts/1000);
     }
     break;	
+  case OS_US:
+    dpush(time_us_64());
+    break;
+  case OS_NS:			/* the timer counts us */
+    dpush64(time_us_64() * 1000);
+    break;
+  case OS_CYCLES:		/* no cycle counter on the M0+: count from the timer */
+    dpush64(time_us_64() * (clock_get_hz(clk_sys) / 1000000));
+    break;
+  case OS_IDLE:			/* sleep_ms waits with wfe */
+    fflush(stdout);
+    /* fallthrough */
   case MCU_DELAY:	
     sleep_ms(dpop());
     break;
   case OS_EMIT:			/* emit */
     txc(dpop()&0xff);
     break;
+  case OS_TYPE:			/* type */
+    r1 = dpop();
+    r2 = dpop();
+    if ((int32_t)r1 > 0)
+      txs((r2 & 0x80000000) ? (char*)&tbforth_ram[r2 & 0x7FFFFFFF] :
+	  (char*)&tbforth_dict[r2], r1);
+    break;
+  case OS_FLUSH:
+    (void)dpop();
+    fflush(stdout);
+    break;
   case OS_KEY:			/* key */
     dpush((CELL)rxc());
     break;
   case OS_SAVE_IMAGE:			/* save image */
     save_image();
     break;
+  case OS_SAVE_SNAPSHOT:
+    save_snapshot();
+    break;
+  case OS_LOAD_SNAPSHOT:
+    if (!load_snapshot()) {
+      txs0("No snapshot\n");
+      return E_ABORT;
+    }
+    return E_EXIT;		/* the interpreter starts over */
   }
   return U_OK;
 }
@@ -263,6 +356,7 @@ int interpret(void) {
       txs0("Return Stack overflow!\n");
       return -1;
     case U_OK:
+    case E_EXIT:
       break;
     default:
       txs0("Ugh\n");
@@ -282,6 +376,14 @@ int main(void) {
 
   load_image();
 
+  // A snapshot carries on where it was saved
+  //
+  if (load_snapshot()) {
+    do {
+      stat=interpret();
+    } while (1);
+  }
+
   // Check version & word_size & max_cells as a "signature" that we have
   // a valid image saved.
   //
@@ -289,6 +391,7 @@ int main(void) {
       dict->word_size == sizeof(CELL) &&
       dict->max_cells == MAX_DICT_CELLS)  {
     tbforth_init();
+    NATIVE_ON();
     tbforth_interpret("init");
   } else {
     // Bootstrap a raw Forth. You are going to have to send core.f, util.f, etc.
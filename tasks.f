@@ -1,54 +1,37 @@
-\ Nothing formal yet.. just a playground to play with a tasking/coroutine concept.
+\ Cooperative tasks.
 \
-
-\ Always Task 0 :  the console and main interpreter.
-\
-uram constant tsk0
-
-\ We always "yield" control back to Task 0, which is resposible for handling
-\ dispatching..
+\ The scheduler is in C (see struct tbforth_sched):
+\	* spawn ( xt uram - task ) - run xt as a new task on its own uram (-1 if it can't)
+\	* yield ( - ) - let the next ready task run
+\	* suspend ( - ) - stop running until somebody resumes us
+\	* resume ( task - ) - make a suspended task ready again
+\	* task-id ( - task ) - who are we? (0 is the interpreter)
+\	* sleep-ms ( ms - ) / at-ms ( ms - ) - sleep for ms / until ms (see ms)
+\	* wait-readable ( fd - ) / wait-writable ( fd - ) - sleep until fd is ready
+\	* (task-end) - where a task goes when its xt returns
 \
-: (yield) uram! ;
-: yield tsk0 uram! ;
+\ A task's uram holds its own stacks (and base, etc). Each task has its own
+\ data and return stacks, so yield (etc) may be called from any depth.
 
-\ make a task.. rstack size datastack size number of cell and a variable for task ref
-\ Are loaded into RAM by allocating the proper amount *right after* the variable
-\ is defined...
+\ Make a task's uram: return stack size, data stack size, number of extra cells
+\ and a variable for task ref. The uram is allocated in RAM *right after* the
+\ variable is defined...
 \
 : make-task ( rssz dssz varcells addr - )
-    >r >r 2dup r> + +  ( rssz dssz total - )
+    >r >r 2dup r> + + 6 +  ( rssz dssz total - )  \ 6 more for the header
     dup allot
-    r@ ! ( r d ) 
-    10 r@ 1+ !  
-    -1 r@ 2 + !  
-    2dup + r@ 3 + ! 
-    r@ 4 + ! 
-    r@ 5 + ! r> drop  ;
-
-: end-task ( task -)
-    yield
-    >r
-    -1 2 r@ + !			\ reset data stack
-    4 r@ + @ 5 r@ +  @ + 3 r> + ! ;	\ reset return stack
-
-
-\ For start-task,  uram! *must* be called directly. This just compiles it into your task
-\ The black magic for tasking relies on the return stack...
-\
-: start-task ( tsk - )
-    [compile] dup [compile] end-task
-    [compile] uram! ; immediate
-
-
+    r@ !			\ uram size
+    r@ 5 + !			\ data stack size
+    r> 6 + ! ;			\ return stack size
 
 \ Take a look at was made
 : .task ( addr - )
     dup @          ." Total RAM = " . cr
     dup 1+ @       ." Base      = " . cr
-    dup 2 + @      ." Stack idx = " . cr
-    dup 3 + @      ." Rstck idx = " . cr
-    dup 4 + @      ." Stack size= " . cr
-    dup 5 + @      ." Rstck size= " . cr drop ;
+    dup 3 + @      ." Stack idx = " . cr
+    dup 4 + @      ." Rstck idx = " . cr
+    dup 5 + @      ." Stack size= " . cr
+    dup 6 + @      ." Rstck size= " . cr drop ;
 
 \ -------------------------------------------------------------------
 \ Examples
@@ -70,30 +53,37 @@ tsk3 .task
 
 : sub-a 15 1 do i . cr yield  loop  ;
 
-: co-a  start-task yield sub-a ;
-: co-b  start-task 15 1 do i 64 + emit cr yield loop ;
+: co-a  sub-a ;
+: co-b  15 1 do i 64 + emit cr yield loop ;
 
-\ Assign words to each task and loop executing each task in a round robin fashion.
-\ Note, yes, this will only implement 5 cycles (not 15).
+\ Start a task on each uram, and let them run while we yield.
+\ Note, yes, this will only implement 5 cycles (not 15) before we
+\ get back to the interpreter (they go on whenever it yields again).
 : doab
-    tsk1 co-a
-    tsk2 co-b
-    5 0 do  tsk1 (yield) tsk2 (yield) loop ;
+    ['] co-a tsk1 spawn drop
+    ['] co-b tsk2 spawn drop
+    5 0 do  yield loop ;
+
+\ A task that sleeps until another one has something for it.
+\
+variable box
+: consumer  begin suspend box @ . cr again ;
+: producer ( task - )  5 0 do i box ! dup resume yield loop drop ;
+: doprod  ['] consumer tsk3 spawn  dup 0< if drop exit then  yield producer ;
 
 \ Time based tasking...
 \
-: (wait) ( ms - ) 0 0 rot poll drop ;
-: wait ( ms - )  0 do 1 (wait) yield loop ;
+: wait ( ms - )  sleep-ms ;
     
-: co-c  start-task yield 10 1 do i . cr 500 wait loop  ;
-: co-d  start-task yield 10 1 do i 64 + emit cr 500 wait loop ;
-: co-e  start-task yield begin [char] . emit 100 wait again  ;
+: co-c  10 1 do i . cr 500 wait loop  ;
+: co-d  10 1 do i 64 + emit cr 500 wait loop ;
+: co-e  begin [char] . emit 100 wait again  ;
 
 : docde
-    tsk1 co-c
-    tsk2 co-d
-    tsk3 co-e
-    begin  tsk1 (yield) tsk2 (yield) tsk3 (yield) again ;
+    ['] co-c tsk1 spawn drop
+    ['] co-d tsk2 spawn drop
+    ['] co-e tsk3 spawn drop
+    begin yield again ;
 
 
 : test-do-no-task  10000000 0 do i drop loop ;
@@ -107,15 +97,9 @@ tsk3 .task
 
 : time-test
    ['] test-do-no-task time-it
-   ['] test-do time-it
-    tsk1 start-task 
-    ['] test-do time-it ;
-: time-test-task
-    time-test begin tsk1 (yield) again ;
+   ['] test-do time-it ;
 
 : loop-tests1
-    start-task
-    yield
     ." testing for .. next: "
     ['] test-for time-it 
     ." testing tail call: "
@@ -124,8 +108,6 @@ tsk3 .task
     ['] test-do time-it ;
 
 : loop-tests2
-    start-task
-    yield
     ." testing begin .. until: "
     ['] test-begin-until time-it 
     ." testing begin .. again: "
@@ -135,8 +117,6 @@ tsk3 .task
 
 : loop-tests-tasks
     ." testing 10 million iteration loops" cr
-    tsk1 loop-tests1
-    tsk2 loop-tests2
-    begin  tsk1 (yield) tsk2 (yield) again ;
-
-
+    ['] loop-tests1 tsk1 spawn drop
+    ['] loop-tests2 tsk2 spawn drop
+    begin yield again ;
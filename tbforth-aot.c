@@ -0,0 +1,58 @@
+/*
+  tbforth-aot - Translate the colon definitions of a saved image to C.
+
+	tbforth-aot [image] > tbforth.img.c
+
+  Each word it can (see tbforth_aot() in tbforth.c) becomes a C function,
+  listed in tbforth_natives[]. A host built with that file and
+  TBFORTH_NATIVE installs them over the same dictionary (see
+  tbforth_native_install()), so deployed firmware runs them natively and
+  still has the console: words defined or changed later are interpreted.
+  "make tbforth.img.c" runs it on tbforth.img.
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include "tbforth.h"
+
+#ifndef TBFORTH_AOT
+#error "tbforth-aot needs tbforth.c built with TBFORTH_AOT"
+#endif
+
+TBFORTH_TLS struct dict *dict;
+
+/* Nothing gets run */
+tbforth_stat c_handle(void) {
+  tbforth_abort_request(ABORT_ILLEGAL);
+  return E_ABORT;
+}
+
+static bool load_image(char *fname) {
+  struct tbforth_image img;
+  int fd = open(fname, O_RDONLY);
+  bool ok;
+
+  if (fd < 0) return 0;
+  ok = read(fd, &img, sizeof(img)) == sizeof(img) &&
+    img.magic == IMAGE_MAGIC && tbforth_image_check(&img, NULL) &&
+    pread(fd, dict, img.size, IMAGE_DATA_OFFSET) == img.size &&
+    tbforth_image_check(&img, dict);
+  close(fd);
+  return ok;
+}
+
+int main(int argc, char* argv[]) {
+  char *image = argc > 1 ? argv[1] : "tbforth.img";
+  uint16_t n;
+
+  dict = calloc(1, sizeof(struct dict));
+  if (!load_image(image)) {
+    fprintf(stderr, "Can't load image %s\n", image);
+    return 1;
+  }
+  tbforth_init();
+  n = tbforth_aot(stdout);
+  fprintf(stderr, "%u words translated\n", n);
+  return 0;
+}
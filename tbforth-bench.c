@@ -0,0 +1,343 @@
+/*
+  tbforth-bench - Time the interpreter on a fixed corpus of benchmarks.
+
+  Starts from the linked in dictionary (as tbforth-posix does), loads the
+  corpus (tests.f, examples/b64.f, tasks.f and bench.f) and runs every
+  benchmark: a few warmup runs, then timed runs of "n bench-<word>" on a
+  monotonic ns clock. Results go to stdout (or -o file) as JSON, or CSV
+  with -c, so runs can be kept and compared:
+
+	tbforth-bench [-c] [-o file] [-w warmup] [-r runs] [-b name]...
+
+  -b runs only the named benchmarks. Output of the corpus itself (emit,
+  type) is thrown away. Build and run with "make bench". "make
+  bench-native" does the same with the corpus translated to C first (see
+  tbforth-aot.c), installed once it is loaded, and "make bench-jit" with
+  the JIT. Its threshold is the number of warmup runs, so each benchmark
+  is timed compiled, unless TBFORTH_JIT sets it (as for tbforth-posix).
+*/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <time.h>
+#include <poll.h>
+#include <math.h>
+#include "tbforth.h"
+
+#ifndef EMBED_IMAGE
+#error "tbforth-bench starts from the linked in image (build with EMBED_IMAGE)"
+#endif
+#include "tbforth.img.h"
+
+#define MAX_RUNS 1000
+#define MAX_SELECTED 32
+
+TBFORTH_TLS struct dict *dict;
+
+static char *corpus[] = { "tests.f", "examples/b64.f", "tasks.f", "bench.f" };
+
+/*
+  The corpus. word is run as "n word" (see bench.f). compile has no word:
+  compile_src is interpreted n times per run, and the words it made are
+  forgotten (untimed) after each run.
+*/
+static struct bench {
+  char *name;
+  char *word;
+  RAMC n;			/* iterations per run */
+} benches[] = {
+  { "for-next",    "bench-for",       1000000 },
+  { "do-loop",     "bench-do",        1000000 },
+  { "begin-until", "bench-until",     1000000 },
+  { "tail-call",   "bench-tail",      1000000 },
+  { "fib",         "bench-fib",            20 },
+  { "factorial",   "bench-factorial",  100000 },
+  { "factor",      "bench-factor",       2000 },
+  { "bcopy",       "bench-bcopy",      200000 },
+  { "bstr=",       "bench-bstr=",      200000 },
+  { "find",        "bench-find",       100000 },
+  { "compile",     NULL,                   50 },
+  { "b64",         "bench-b64",          2000 },
+  { "task-switch", "bench-switch",     100000 },
+};
+#define NBENCHES (sizeof(benches)/sizeof(benches[0]))
+
+static char compile_src[] =
+  ": (c1) ( a b - c ) 2dup + >r * r> - ; "
+  ": (c2) ( - ) 100 0 do i 3 (c1) drop loop ; "
+  ": (c3) ( n - ) begin 1- dup 0= until drop ; "
+  ": (c4) ( n - f ) dup 10 > if 2 * else 3 + then 255 and $1F = ;";
+
+struct result {
+  struct bench *b;
+  int runs;
+  uint64_t min, median, max;
+  double mean, stddev;
+};
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static uint64_t start_ns;
+
+/*
+  Just what the corpus needs: console output (dropped), time and sleeping.
+*/
+tbforth_stat c_handle(void) {
+  RAMC r1 = dpop();
+
+  switch(r1) {
+  case OS_EMIT:
+  case OS_FLUSH:
+    (void)dpop();
+    break;
+  case OS_TYPE:
+    tbforth_uram->didx -= 2;
+    break;
+  case OS_KEY:
+    dpush(-1);
+    break;
+  case OS_SECS:
+    dpush(time(0));
+    break;
+  case OS_MS:
+    dpush((now_ns() - start_ns) / 1000000);
+    break;
+  case OS_US:
+    dpush((now_ns() - start_ns) / 1000);
+    break;
+  case OS_IDLE:
+    poll(NULL, 0, dpop());
+    break;
+  default:
+    tbforth_abort_request(ABORT_ILLEGAL);
+    return E_ABORT;
+  }
+  return U_OK;
+}
+
+/* Each line in place, as tbforth-posix's include does */
+static tbforth_stat load_file(char *fname) {
+  tbforth_stat stat = U_OK;
+  char *buf, *p, *nl;
+  long len;
+  int lineno = 0;
+  FILE *fp = fopen(fname, "r");
+
+  if (fp == NULL) {
+    fprintf(stderr, "Can't open %s\n", fname);
+    return E_ABORT;
+  }
+  fseek(fp, 0, SEEK_END);
+  len = ftell(fp);
+  rewind(fp);
+  buf = malloc(len + 1);
+  if (fread(buf, 1, len, fp) != (size_t)len) len = 0;
+  fclose(fp);
+  buf[len] = '\0';
+
+  for (p = buf; stat == U_OK && p < buf + len; p = nl + 1) {
+    lineno++;
+    if ((nl = memchr(p, '\n', buf + len - p)) == NULL) nl = buf + len;
+    stat = tbforth_interpret_src(p, nl - p);
+  }
+  if (stat != U_OK)
+    fprintf(stderr, "%s: error %d at line %d\n", fname, stat, lineno);
+  free(buf);
+  return stat;
+}
+
+static tbforth_stat run(char *code) {
+  tbforth_stat stat = tbforth_interpret_src(code, strlen(code));
+  if (stat != U_OK)
+    fprintf(stderr, "error %d in '%s'\n", stat, code);
+  return stat;
+}
+
+/* One run of b: ns taken, 0 on error */
+static uint64_t run_once(struct bench *b) {
+  char code[64];
+  uint64_t t0, t;
+  RAMC i;
+
+  if (b->word == NULL) {
+    if (run("mark (bench)") != U_OK) return 0;
+    t0 = now_ns();
+    for (i = 0; i < b->n; i++)
+      if (run(compile_src) != U_OK) return 0;
+    t = now_ns() - t0;
+    return run("forget-to-mark (bench)") == U_OK ? t : 0;
+  }
+  snprintf(code, sizeof(code), "%u %s", b->n, b->word);
+  t0 = now_ns();
+  if (run(code) != U_OK) return 0;
+  t = now_ns() - t0;
+  return t ? t : 1;
+}
+
+static int cmp_u64(const void *x, const void *y) {
+  uint64_t a = *(const uint64_t*)x, b = *(const uint64_t*)y;
+  return a < b ? -1 : a > b;
+}
+
+static bool measure(struct bench *b, int warmup, int runs, struct result *r) {
+  static uint64_t t[MAX_RUNS];
+  double sum = 0, var = 0;
+  int i;
+
+  for (i = 0; i < warmup; i++)
+    if (run_once(b) == 0) return 0;
+  for (i = 0; i < runs; i++)
+    if ((t[i] = run_once(b)) == 0) return 0;
+  qsort(t, runs, sizeof(t[0]), cmp_u64);
+  for (i = 0; i < runs; i++) sum += t[i];
+  r->b = b;
+  r->runs = runs;
+  r->min = t[0];
+  r->max = t[runs-1];
+  r->median = runs & 1 ? t[runs/2] : (t[runs/2-1] + t[runs/2]) / 2;
+  r->mean = sum / runs;
+  for (i = 0; i < runs; i++) var += (t[i] - r->mean) * (t[i] - r->mean);
+  r->stddev = sqrt(var / runs);
+  return 1;
+}
+
+/* What the numbers were measured on */
+static char *build_config(void) {
+  return ""
+#ifdef THREADED_DISPATCH
+    "threaded "
+#else
+    "switch "
+#endif
+#ifdef TOS_CACHE
+    "tos-cache "
+#endif
+#ifdef FUSE_SUPERINSTRUCTIONS
+    "superinstructions "
+#endif
+#ifdef DICT_HASH_SLOTS
+    "dict-hash "
+#endif
+#ifdef TBFORTH_NATIVE
+    "native"
+#endif
+#ifdef TBFORTH_JIT
+    "jit"
+#endif
+    ;
+}
+
+static void write_json(FILE *fp, struct result *r, int n, int warmup) {
+  int i;
+
+  fprintf(fp, "{\n  \"tbforth\": \"%s\",\n  \"dict_version\": %d,\n",
+	  TBFORTH_VERSION, DICT_VERSION);
+  fprintf(fp, "  \"config\": \"%s\",\n  \"warmup\": %d,\n  \"results\": [\n",
+	  build_config(), warmup);
+  for (i = 0; i < n; i++, r++)
+    fprintf(fp, "    {\"name\": \"%s\", \"iterations\": %u, \"runs\": %d, "
+	    "\"min_ns\": %llu, \"median_ns\": %llu, \"mean_ns\": %.0f, "
+	    "\"max_ns\": %llu, \"stddev_ns\": %.0f, \"ns_per_iter\": %.3f}%s\n",
+	    r->b->name, r->b->n, r->runs, (unsigned long long)r->min,
+	    (unsigned long long)r->median, r->mean, (unsigned long long)r->max,
+	    r->stddev, (double)r->median / r->b->n, i < n-1 ? "," : "");
+  fprintf(fp, "  ]\n}\n");
+}
+
+static void write_csv(FILE *fp, struct result *r, int n) {
+  int i;
+
+  fprintf(fp, "name,iterations,runs,min_ns,median_ns,mean_ns,max_ns,stddev_ns,ns_per_iter\n");
+  for (i = 0; i < n; i++, r++)
+    fprintf(fp, "%s,%u,%d,%llu,%llu,%.0f,%llu,%.0f,%.3f\n",
+	    r->b->name, r->b->n, r->runs, (unsigned long long)r->min,
+	    (unsigned long long)r->median, r->mean, (unsigned long long)r->max,
+	    r->stddev, (double)r->median / r->b->n);
+}
+
+static bool selected(char *name, char **sel, int nsel) {
+  int i;
+  if (nsel == 0) return 1;
+  for (i = 0; i < nsel; i++)
+    if (strcmp(name, sel[i]) == 0) return 1;
+  return 0;
+}
+
+int main(int argc, char* argv[]) {
+  struct result results[NBENCHES];
+  char *sel[MAX_SELECTED];
+  int nsel = 0, warmup = 2, runs = 10, n = 0, opt;
+  bool csv = 0;
+  char *out = NULL;
+  FILE *fp = stdout;
+  size_t i;
+
+  while ((opt = getopt(argc, argv, "co:w:r:b:")) != -1) {
+    switch (opt) {
+    case 'c': csv = 1; break;
+    case 'o': out = optarg; break;
+    case 'w': warmup = atoi(optarg); break;
+    case 'r': runs = atoi(optarg); break;
+    case 'b':
+      if (nsel < MAX_SELECTED) sel[nsel++] = optarg;
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-c] [-o file] [-w warmup] [-r runs] [-b name]...\n",
+	      argv[0]);
+      return 1;
+    }
+  }
+  for (opt = 0; opt < nsel; opt++) {
+    for (i = 0; i < NBENCHES && strcmp(sel[opt], benches[i].name); i++) ;
+    if (i == NBENCHES) {
+      fprintf(stderr, "No benchmark %s\n", sel[opt]);
+      return 1;
+    }
+  }
+  if (runs < 1) runs = 1;
+  if (runs > MAX_RUNS) runs = MAX_RUNS;
+  if (warmup < 0) warmup = 0;
+
+  dict = &flashdict;
+  start_ns = now_ns();
+  tbforth_init();
+  if (run("init") != U_OK) return 1;
+  for (i = 0; i < sizeof(corpus)/sizeof(corpus[0]); i++)
+    if (load_file(corpus[i]) != U_OK) return 1;
+#ifdef TBFORTH_NATIVE
+  fprintf(stderr, "%u of %u words native\n",
+	  tbforth_native_install(tbforth_natives, tbforth_nnatives),
+	  tbforth_nnatives);
+#endif
+#ifdef TBFORTH_JIT
+  /* A run is one call: compile the benchmark words while warming up */
+  tbforth_jit_threshold(getenv("TBFORTH_JIT") ? atoi(getenv("TBFORTH_JIT")) :
+			warmup > 0 ? warmup : 1);
+#endif
+
+  for (i = 0; i < NBENCHES; i++) {
+    if (!selected(benches[i].name, sel, nsel)) continue;
+    fprintf(stderr, "%s...\n", benches[i].name);
+    if (!measure(&benches[i], warmup, runs, &results[n])) {
+      fprintf(stderr, "%s failed\n", benches[i].name);
+      return 1;
+    }
+    n++;
+  }
+
+  if (out != NULL && (fp = fopen(out, "w")) == NULL) {
+    fprintf(stderr, "Can't write %s\n", out);
+    return 1;
+  }
+  if (csv)
+    write_csv(fp, results, n);
+  else
+    write_json(fp, results, n, warmup);
+  if (fp != stdout) fclose(fp);
+  return 0;
+}
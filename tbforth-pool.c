@@ -0,0 +1,502 @@
+/*
+  tbforth-pool - Run lots of small jobs through a pool of interpreters.
+
+  The saved image (tbforth.img) plus any rule files given with -f make up
+  the base dictionary. Each worker thread owns an interpreter instance
+  (struct tbforth_vm) with its own RAM and a copy-on-write view of the
+  base dictionary. Jobs are read from stdin, one per line:
+
+	word<TAB>input
+
+  The input is interpreted (e.g. to push telemetry values), then word is
+  run. For every job one line is written to stdout:
+
+	jobno<TAB>status<TAB>data stack (bottom first)<TAB>emitted text
+
+  Jobs finish in any order (jobno is the input line number). Before each
+  job the worker restores its RAM, and the dictionary pages the last job
+  wrote (words it defined, a value it changed), to what they were after
+  loading, and drops the tasks it left, so jobs don't see each other.
+
+  Build with "make tbforth-pool" (tbforth.c is compiled with TBFORTH_THREADS).
+*/
+#define _GNU_SOURCE			/* memfd_create() */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#include <unistd.h>
+#include <time.h>
+#include <sys/time.h>
+#include <pthread.h>
+#include <sched.h>
+#include <semaphore.h>
+#include <stdatomic.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include "tbforth.h"
+
+#ifndef TBFORTH_THREADS
+#error "tbforth-pool needs tbforth.c built with TBFORTH_THREADS"
+#endif
+
+#define CONFIG_IMAGE_FILE "tbforth.img"
+#define MAX_RULE_FILES 16
+#define OUT_BYTES 512			/* emitted text kept per job */
+#define QUEUE_SLOTS 1024		/* must be a power of 2 */
+
+TBFORTH_TLS struct dict *dict;
+static uint64_t start_ns;
+
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/*
+  A job and where its output goes.
+*/
+struct job {
+  unsigned long no;
+  char *line;			/* word<TAB>input (malloc'd) */
+};
+
+struct job_out {
+  int len;
+  char buf[OUT_BYTES];
+};
+
+/*
+  Bounded lock free multi producer/multi consumer queue (D. Vyukov).
+  Each slot's seq says whose turn it is: pos for a producer, pos+1 for
+  a consumer. Idle workers and a producer facing a full queue sleep on
+  the semaphores (which only enter the kernel when someone has to).
+*/
+static struct {
+  struct {
+    atomic_size_t seq;
+    struct job job;
+  } slot[QUEUE_SLOTS];
+  atomic_size_t head;		/* next to dequeue */
+  atomic_size_t tail;		/* next to enqueue */
+  sem_t jobs;			/* jobs queued, plus one per worker at close */
+  sem_t room;			/* free slots */
+} queue;
+
+static void queue_init(void) {
+  for (size_t i = 0; i < QUEUE_SLOTS; i++)
+    atomic_init(&queue.slot[i].seq, i);
+  atomic_init(&queue.head, 0);
+  atomic_init(&queue.tail, 0);
+  sem_init(&queue.jobs, 0, 0);
+  sem_init(&queue.room, 0, QUEUE_SLOTS);
+}
+
+static bool queue_put(struct job *j) {
+  size_t pos = atomic_load_explicit(&queue.tail, memory_order_relaxed);
+  for (;;) {
+    size_t seq = atomic_load_explicit(&queue.slot[pos & (QUEUE_SLOTS-1)].seq,
+				      memory_order_acquire);
+    intptr_t dif = (intptr_t)seq - (intptr_t)pos;
+    if (dif == 0) {
+      if (atomic_compare_exchange_weak_explicit(&queue.tail, &pos, pos+1,
+						memory_order_relaxed,
+						memory_order_relaxed))
+	break;
+    } else if (dif < 0) {
+      return 0;			/* full */
+    } else {
+      pos = atomic_load_explicit(&queue.tail, memory_order_relaxed);
+    }
+  }
+  queue.slot[pos & (QUEUE_SLOTS-1)].job = *j;
+  atomic_store_explicit(&queue.slot[pos & (QUEUE_SLOTS-1)].seq, pos+1,
+			memory_order_release);
+  return 1;
+}
+
+static bool queue_get(struct job *j) {
+  size_t pos = atomic_load_explicit(&queue.head, memory_order_relaxed);
+  for (;;) {
+    size_t seq = atomic_load_explicit(&queue.slot[pos & (QUEUE_SLOTS-1)].seq,
+				      memory_order_acquire);
+    intptr_t dif = (intptr_t)seq - (intptr_t)(pos+1);
+    if (dif == 0) {
+      if (atomic_compare_exchange_weak_explicit(&queue.head, &pos, pos+1,
+						memory_order_relaxed,
+						memory_order_relaxed))
+	break;
+    } else if (dif < 0) {
+      return 0;			/* empty */
+    } else {
+      pos = atomic_load_explicit(&queue.head, memory_order_relaxed);
+    }
+  }
+  *j = queue.slot[pos & (QUEUE_SLOTS-1)].job;
+  atomic_store_explicit(&queue.slot[pos & (QUEUE_SLOTS-1)].seq,
+			pos+QUEUE_SLOTS, memory_order_release);
+  return 1;
+}
+
+/*
+  Only the OS words that make sense for a job are here: time, and emit
+  (which goes into the job's output). The rest abort the job.
+*/
+static tbforth_stat pool_c_handle(struct tbforth_vm *vm) {
+  struct job_out *out = vm->host;
+  RAMC r1 = dpop();
+
+  switch(r1) {
+  case OS_EMIT:
+    r1 = dpop();
+    if (out->len < OUT_BYTES) out->buf[out->len++] = r1;
+    break;
+  case OS_TYPE:
+    r1 = dpop();
+    {
+      RAMC a = dpop();
+      char *s = (a & 0x80000000) ? (char*)&tbforth_ram[a & 0x7FFFFFFF] :
+	(char*)&tbforth_dict[a];
+      if ((int32_t)r1 > OUT_BYTES - out->len) r1 = OUT_BYTES - out->len;
+      if ((int32_t)r1 > 0) {
+	memcpy(out->buf + out->len, s, r1);
+	out->len += r1;
+      }
+    }
+    break;
+  case OS_FLUSH:
+    (void)dpop();
+    break;
+  case OS_KEY:
+    dpush(-1);
+    break;
+  case OS_SECS:
+    dpush(time(0));
+    break;
+  case OS_MS:
+    dpush((now_ns() - start_ns) / 1000000);
+    break;
+  case OS_US:
+    dpush((now_ns() - start_ns) / 1000);
+    break;
+  case OS_NS:
+    dpush64(now_ns());
+    break;
+  case OS_IDLE:
+    poll(NULL, 0, dpop());
+    break;
+  case OS_WAIT_FD:		/* jobs have no fds to wait on */
+    tbforth_uram->didx -= 2;
+    dtop() = 0;
+    break;
+  default:
+    tbforth_abort_request(ABORT_ILLEGAL);
+    return E_ABORT;
+  }
+  return U_OK;
+}
+
+tbforth_stat c_handle(void) {
+  return pool_c_handle(tbforth_cur_vm);
+}
+
+static char *rule_files[MAX_RULE_FILES];
+static int nrule_files;
+
+/*
+  The base dictionary is loaded once into a memfd. Workers map it
+  privately: its pages stay shared between them until an instance writes
+  one (new words, a value, the header's here/last), and then the kernel
+  gives that instance its own copy of just that page. Without memfd every
+  worker gets a full copy.
+*/
+static struct dict *base_dict;
+static int base_fd = -1;
+
+static struct dict *new_base_dict(void) {
+  void *d = MAP_FAILED;
+#ifdef MFD_CLOEXEC
+  base_fd = memfd_create("tbforth-dict", MFD_CLOEXEC);
+  if (base_fd >= 0 && ftruncate(base_fd, sizeof(struct dict)) == 0)
+    d = mmap(0, sizeof(struct dict), PROT_READ|PROT_WRITE, MAP_SHARED,
+	     base_fd, 0);
+#endif
+  if (d != MAP_FAILED) return d;
+  if (base_fd >= 0) close(base_fd);
+  base_fd = -1;
+  return calloc(1, sizeof(struct dict));
+}
+
+static struct dict *instance_dict(void) {
+  struct dict *d;
+  if (base_fd >= 0) {
+    d = mmap(0, sizeof(struct dict), PROT_READ|PROT_WRITE, MAP_PRIVATE,
+	     base_fd, 0);
+    if (d != MAP_FAILED) return d;
+  }
+  d = mmap(0, sizeof(struct dict), PROT_READ|PROT_WRITE,
+	   MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+  if (d == MAP_FAILED) return NULL;
+  memcpy(d, base_dict, sizeof(struct dict));
+  return d;
+}
+
+/*
+  Job isolation: a worker maps the base dictionary, up to the page
+  holding here, read only. The first write a job makes to one of those
+  pages (a !, a to, defining a word) faults; dict_fault() makes the page
+  writable and notes it, and after the job dict_restore() maps it from
+  the base dictionary again. Jobs that don't write the dictionary cost
+  nothing.
+*/
+static long page;
+static TBFORTH_TLS char *guard_lo, *guard_hi;	/* read only between jobs */
+static TBFORTH_TLS char *dirty_lo, *dirty_hi;	/* written by this job */
+
+static void dict_fault(int sig, siginfo_t *si, void *uc) {
+  char *a = si->si_addr, *p;
+
+  if (a >= guard_lo && a < guard_hi) {
+    p = guard_lo + ((a - guard_lo) & ~(page - 1));
+    if (mprotect(p, page, PROT_READ|PROT_WRITE) == 0) {
+      if (dirty_lo == NULL || p < dirty_lo) dirty_lo = p;
+      if (p + page > dirty_hi) dirty_hi = p + page;
+      return;
+    }
+  }
+  signal(sig, SIG_DFL);		/* a real fault: crash on the way back */
+}
+
+static bool dict_restore(void) {
+  size_t off, len;
+
+  if (dirty_lo == NULL) return 1;
+  off = dirty_lo - guard_lo;
+  len = dirty_hi - dirty_lo;
+  dirty_lo = dirty_hi = NULL;
+  if (base_fd >= 0)
+    return mmap(guard_lo + off, len, PROT_READ, MAP_PRIVATE|MAP_FIXED,
+		base_fd, off) != MAP_FAILED;
+  memcpy(guard_lo + off, (char*)base_dict + off, len);
+  return mprotect(guard_lo + off, len, PROT_READ) == 0;
+}
+
+/* Make d, as it is now, what dict_restore() goes back to */
+static bool dict_guard(struct dict *d) {
+  size_t top = ((char*)&((CELL*)d)[d->here] - (char*)d) / page * page + page;
+
+  if (top > sizeof(struct dict)) top = sizeof(struct dict);
+  guard_lo = (char*)d;
+  guard_hi = guard_lo + top;
+  dirty_lo = guard_lo;		/* all of it, to map it read only */
+  dirty_hi = guard_hi;
+  return dict_restore();
+}
+
+static bool load_image(char *fname) {
+  struct tbforth_image img;
+  int fd = open(fname, O_RDONLY);
+  bool ok;
+
+  if (fd < 0) return 0;
+  ok = read(fd, &img, sizeof(img)) == sizeof(img) &&
+    tbforth_image_check(&img, NULL) &&
+    pread(fd, base_dict, img.size, IMAGE_DATA_OFFSET) == img.size &&
+    tbforth_image_check(&img, base_dict);
+  close(fd);
+  return ok;
+}
+
+static tbforth_stat interpret_file(char *fname) {
+  char line[TIB_SIZE];
+  tbforth_stat stat = U_OK;
+  FILE *fp = fopen(fname, "r");
+  if (fp == NULL) return E_ABORT;
+  while (stat == U_OK && fgets(line, sizeof(line), fp) != NULL)
+    stat = tbforth_interpret(line);
+  fclose(fp);
+  return stat;
+}
+
+/*
+  Run one job on the current instance and format its result line.
+*/
+static int run_job(struct job *j, struct job_out *out, char *res, int rmax) {
+  tbforth_stat stat = U_OK;
+  char *word = j->line, *input = strchr(j->line, '\t');
+  int n, i;
+
+  if (input != NULL) *input++ = '\0';
+  out->len = 0;
+  if ((input != NULL && strlen(input) >= TIB_SIZE) || strlen(word) >= TIB_SIZE)
+    stat = E_ABORT;		/* won't fit in the tib */
+  if (stat == U_OK && input != NULL && *input)
+    stat = tbforth_interpret(input);
+  if (stat == U_OK)
+    stat = tbforth_interpret(word);
+
+  n = snprintf(res, rmax, "%lu\t%d\t", j->no, stat);
+  for (i = 0; stat == U_OK && i <= (int32_t)tbforth_uram->didx && n < rmax; i++)
+    n += snprintf(res+n, rmax-n, i ? " %d" : "%d", (int32_t)tbforth_uram->ds[i]);
+  if (n > rmax-2) n = rmax-2;	/* truncated */
+  res[n++] = '\t';
+  for (i = 0; i < out->len && n < rmax-1; i++)
+    res[n++] = (out->buf[i] == '\n' || out->buf[i] == '\t' ||
+		out->buf[i] == '\r') ? ' ' : out->buf[i];
+  res[n++] = '\n';
+  return n;
+}
+
+/*
+  Rule files are compiled once, into the base dictionary (by the main
+  thread, before the workers map it). The RAM they leave (variables,
+  task urams...) is what every job starts with.
+*/
+static RAMC *base_ram;
+
+static bool load_rules(void) {
+  static struct tbforth_vm vm;
+  static struct job_out out;
+  RAMC *ram = malloc(TOTAL_RAM_CELLS*sizeof(RAMC));
+  int i;
+
+  tbforth_vm_setup(&vm, base_dict, ram);
+  vm.c_handle = pool_c_handle;
+  vm.host = &out;
+  tbforth_vm_select(&vm);
+  tbforth_init();
+  tbforth_interpret("init");
+  for (i = 0; i < nrule_files; i++) {
+    if (interpret_file(rule_files[i]) != U_OK) {
+      fprintf(stderr, "Can't load %s\n", rule_files[i]);
+      return 0;
+    }
+  }
+  base_ram = ram;
+  return 1;
+}
+
+/* Wait for a job. 0: the queue was closed and is empty. */
+static bool next_job(struct job *j) {
+  while (sem_wait(&queue.jobs) != 0)
+    ;				/* EINTR */
+  if (!queue_get(j)) return 0;
+  sem_post(&queue.room);
+  return 1;
+}
+
+static void add_job(struct job *j) {
+  while (sem_wait(&queue.room) != 0)
+    ;
+  while (!queue_put(j)) sched_yield(); /* a worker is still copying out */
+  sem_post(&queue.jobs);
+}
+
+/*
+  No more jobs: every worker gets one more post, and finds the queue
+  empty once all the jobs are taken.
+*/
+static void close_queue(long nworkers) {
+  for (long i = 0; i < nworkers; i++)
+    sem_post(&queue.jobs);
+}
+
+static void *worker(void *arg) {
+  struct tbforth_vm vm;
+  struct job_out out;
+  struct dict *d = instance_dict();
+  RAMC *ram = malloc(TOTAL_RAM_CELLS*sizeof(RAMC));
+  char res[OUT_BYTES+1024];
+  struct job j;
+  int n;
+
+  tbforth_vm_setup(&vm, d, ram);
+  vm.c_handle = pool_c_handle;
+  vm.host = &out;
+  tbforth_vm_select(&vm);
+  tbforth_init();
+  if (!dict_guard(d)) {
+    perror("tbforth-pool: dictionary");
+    exit(1);
+  }
+
+  while (next_job(&j)) {
+    memcpy(ram, base_ram, TOTAL_RAM_CELLS*sizeof(RAMC));
+    if (!dict_restore()) {
+      perror("tbforth-pool: dictionary");
+      exit(1);
+    }
+    tbforth_uram = (struct tbforth_uram*)((char*)ram + sizeof(struct tbforth_iram));
+    tbforth_sched_reset();	/* tasks the last job left */
+    tbforth_abort_clr();
+
+    n = run_job(&j, &out, res, sizeof(res)-1);
+    fwrite(res, 1, n, stdout);	/* stdio locks: lines don't mix */
+    free(j.line);
+  }
+  return arg;
+}
+
+int main(int argc, char* argv[]) {
+  char *image = CONFIG_IMAGE_FILE;
+  long nworkers = sysconf(_SC_NPROCESSORS_ONLN);
+  pthread_t *threads;
+  char *line = NULL;
+  size_t cap = 0;
+  ssize_t len;
+  struct job j;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "j:i:f:")) != -1) {
+    switch (opt) {
+    case 'j': nworkers = atol(optarg); break;
+    case 'i': image = optarg; break;
+    case 'f':
+      if (nrule_files < MAX_RULE_FILES) rule_files[nrule_files++] = optarg;
+      break;
+    default:
+      fprintf(stderr, "usage: %s [-j workers] [-i image] [-f rules.f]...\n",
+	      argv[0]);
+      return 1;
+    }
+  }
+  if (nworkers < 1) nworkers = 1;
+  page = sysconf(_SC_PAGESIZE);
+  {
+    struct sigaction sa;
+    memset(&sa, 0, sizeof(sa));
+    sa.sa_sigaction = dict_fault;
+    sa.sa_flags = SA_SIGINFO;
+    sigaction(SIGSEGV, &sa, 0);
+  }
+  base_dict = new_base_dict();
+  if (!load_image(image)) {
+    fprintf(stderr, "Can't load image %s\n", image);
+    return 1;
+  }
+  if (!load_rules()) return 1;
+  start_ns = now_ns();
+  queue_init();
+
+  threads = malloc(nworkers * sizeof(pthread_t));
+  for (long i = 0; i < nworkers; i++)
+    pthread_create(&threads[i], 0, worker, 0);
+
+  j.no = 0;
+  while ((len = getline(&line, &cap, stdin)) != -1) {
+    j.no++;
+    if (len > 0 && line[len-1] == '\n') line[--len] = '\0';
+    if (len == 0) continue;
+    j.line = strdup(line);
+    add_job(&j);
+  }
+  close_queue(nworkers);
+
+  for (long i = 0; i < nworkers; i++)
+    pthread_join(threads[i], 0);
+  free(line);
+  return 0;
+}
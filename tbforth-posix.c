@@ -6,24 +6,65 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <string.h>
+#include <ctype.h>
 #include <sys/time.h>
+#include <signal.h>
 #include <poll.h>
 #include <sys/socket.h>
+#include <sys/mman.h>
 #include <netdb.h>
 #include "tbforth.h"
 #include <errno.h>
+#include <time.h>
+#ifdef __linux__
+#include <sys/epoll.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
 
 FILE *OUTFP;
 FILE *INFP;
+static bool batch;		/* no readline, prompts or per line flushing */
 
 #define CONFIG_IMAGE_FILE "tbforth.img"
 
 
-struct dict *dict;
-struct timeval start_tv;
+TBFORTH_TLS struct dict *dict;
+static uint64_t start_ns;	/* ms and us count from here */
+
+/* Monotonic: ms, us, sleepers etc don't jump with the wall clock */
+static uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+/* The CPU's own counter where there is one (the TSC may not be invariant) */
+static uint64_t cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+  return __rdtsc();
+#elif defined(__aarch64__)
+  uint64_t c;
+  __asm__ volatile("mrs %0, cntvct_el0" : "=r"(c));
+  return c;
+#else
+  return now_ns();
+#endif
+}
+
+/*
+  With EMBED_IMAGE (the default build) the dictionary saved by the
+  bootstrap build (see Makefile) is linked in, as on the MCUs, and we
+  start from it instead of parsing core.f and util.f.
+*/
+#ifdef EMBED_IMAGE
+#include "tbforth.img.h"
+#endif
 
 
 uint8_t rxc(void) {
+  fflush(OUTFP);
   return getc(INFP);
 }
 
@@ -45,6 +86,7 @@ char *rl_gets (void)
     }
 
   /* Get a line from the user. */
+  fflush(OUTFP);
   line_read = readline ("");
 
   /* If the line has any text in it,
@@ -58,42 +100,179 @@ void rxgetline(char* str) {
   (void)fgets(str,128,stdin);
 }
 
+/*
+  Console output is flushed a line at a time (only when the buffer fills
+  in batch mode), before reading and when the scheduler idles (or on
+  flush).
+*/
 void txc(uint8_t c) {
   fputc(c, OUTFP);
-  fflush(OUTFP);
+  if (c == '\n' && !batch) fflush(OUTFP);
 }
 
 void txs(char* s, int cnt) {
   fwrite(s,cnt,1,OUTFP);
-  fflush(OUTFP);
+  if (!batch && memchr(s, '\n', cnt)) fflush(OUTFP);
 }
 #define txs0(s) txs(s,strlen(s))
 
-static FILE *cfp;
-bool config_open_w(char* f) {
-  cfp = fopen(f, "w+");
-  return (cfp != NULL);
+#ifdef TBFORTH_OPSTATS
+/* Write .opstats to the file named by $TBFORTH_OPSTATS (if any) at exit */
+static void opstats_at_exit(void) {
+  char *fname = getenv("TBFORTH_OPSTATS");
+  FILE *fp;
+
+  if (fname == NULL || (fp = fopen(fname, "w")) == NULL) return;
+  fflush(OUTFP);
+  OUTFP = fp;
+  tbforth_interpret(".opstats");
+  fclose(fp);
+  OUTFP = stdout;
+}
+#endif
+
+#ifdef TBFORTH_PROFILE
+/*
+  Sample the running word every us of CPU time (SIGPROF), 0 stops. The
+  per call clock is off while sampling.
+*/
+static void on_sigprof(int sig) {
+  (void)sig;
+  tbforth_profile_sample();
 }
 
-bool config_open_r(char* f) {
-  cfp = fopen(f, "r");
-  return (cfp != NULL);
+static void profile_sample(RAMC us) {
+  struct itimerval it = {{us / 1000000, us % 1000000},
+			 {us / 1000000, us % 1000000}};
+  struct sigaction sa;
+
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = on_sigprof;
+  sa.sa_flags = SA_RESTART;
+  sigaction(SIGPROF, &sa, NULL);
+  setitimer(ITIMER_PROF, &it, NULL);
+  tbforth_profile_timing(us == 0);
+}
+#endif
+
+/*
+  Images: a struct tbforth_image header, then the dictionary (up to here)
+  at IMAGE_DATA_OFFSET.
+*/
+static bool image_save(char *fname) {
+  struct tbforth_image img;
+  int fd = open(fname, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+  bool ok;
+
+  if (fd < 0) return 0;
+  tbforth_image_header(&img);
+  ok = pwrite(fd, &img, sizeof(img), 0) == sizeof(img) &&
+    pwrite(fd, dict, img.size, IMAGE_DATA_OFFSET) == img.size;
+  close(fd);
+  return ok;
 }
 
-bool config_write(char *src, uint16_t size) {
-  fprintf(cfp,"%d\n", (int)size);
-  fwrite((char*)src, size, 1, cfp);
-  return 1;
+/*
+  Snapshots: an image whose header is a struct tbforth_snapshot, with
+  all of tbforth_ram after the dictionary at SNAPSHOT_RAM_OFFSET.
+*/
+static bool snapshot_save(char *fname) {
+  struct tbforth_snapshot s;
+  int fd = open(fname, O_WRONLY|O_CREAT|O_TRUNC, 0644);
+  bool ok;
+
+  if (fd < 0) return 0;
+  tbforth_snapshot_header(&s);
+  ok = pwrite(fd, &s, sizeof(s), 0) == sizeof(s) &&
+    pwrite(fd, dict, s.img.size, IMAGE_DATA_OFFSET) == s.img.size &&
+    pwrite(fd, tbforth_ram, SNAPSHOT_RAM_BYTES, SNAPSHOT_RAM_OFFSET) ==
+    SNAPSHOT_RAM_BYTES;
+  close(fd);
+  return ok;
 }
 
-bool config_read(char *dest) {
-  int size;
-  (void)fscanf(cfp,"%d\n",(int*)&size);
-   (void)fread((char*)dest, size, 1, cfp);
-  return 1;
+/*
+  A private (copy on write) mapping of size bytes with len bytes of the
+  file at off over the start of it. Nothing is copied until written to.
+*/
+static void *file_map(int fd, off_t off, size_t len, size_t size) {
+  void *p = mmap(NULL, size, PROT_READ|PROT_WRITE,
+		 MAP_PRIVATE|MAP_ANONYMOUS, -1, 0);
+
+  if (p == MAP_FAILED) return NULL;
+  if (off % sysconf(_SC_PAGESIZE) != 0 ||
+      mmap(p, len, PROT_READ|PROT_WRITE, MAP_PRIVATE|MAP_FIXED,
+	   fd, off) == MAP_FAILED) {
+    if (pread(fd, p, len, off) != len) {
+      munmap(p, size);
+      return NULL;
+    }
+  }
+  return p;
+}
+
+/*
+  Map an image (or snapshot) to run in place. For a snapshot, *ram is
+  set to its mapped RAM (else NULL).
+*/
+static struct dict *image_map(char *fname, struct tbforth_snapshot *s,
+			      RAMC **ram) {
+  struct dict *d = NULL;
+  struct stat st;
+  int fd = open(fname, O_RDONLY);
+
+  *ram = NULL;
+  if (fd < 0) return NULL;
+  if (pread(fd, s, sizeof(*s), 0) != sizeof(*s) ||
+      !tbforth_image_check(&s->img, NULL) || fstat(fd, &st) < 0 ||
+      st.st_size < IMAGE_DATA_OFFSET + s->img.size)
+    goto out;
+  d = file_map(fd, IMAGE_DATA_OFFSET, s->img.size, sizeof(struct dict));
+  if (d == NULL) goto out;
+  if (s->img.magic == SNAPSHOT_MAGIC) {
+    if (st.st_size >= SNAPSHOT_RAM_OFFSET + SNAPSHOT_RAM_BYTES)
+      *ram = file_map(fd, SNAPSHOT_RAM_OFFSET, SNAPSHOT_RAM_BYTES,
+		      SNAPSHOT_RAM_BYTES);
+    if (*ram != NULL && tbforth_snapshot_check(s, d, *ram)) goto out;
+  } else if (tbforth_image_check(&s->img, d)) {
+    goto out;
+  }
+  munmap(d, sizeof(struct dict));
+  if (*ram != NULL) munmap(*ram, SNAPSHOT_RAM_BYTES);
+  d = NULL;
+  *ram = NULL;
+ out:
+  close(fd);
+  return d;
 }
-bool config_close(void) {
-  fclose(cfp);
+
+#ifdef TBFORTH_NATIVE
+/* Saved dictionaries never hold NATIVE (see tbforth_native_install()) */
+# define NATIVE_OFF() tbforth_native_remove()
+# define NATIVE_ON() tbforth_native_install(tbforth_natives, tbforth_nnatives)
+#elif defined(TBFORTH_JIT)
+# define NATIVE_OFF() tbforth_native_remove()
+# define NATIVE_ON()
+#else
+# define NATIVE_OFF()
+# define NATIVE_ON()
+#endif
+
+/* Replace the running dict and RAM with a snapshot's (see c_handle) */
+static bool snapshot_load(char *fname) {
+  struct tbforth_snapshot s;
+  RAMC *ram;
+  struct dict *d = image_map(fname, &s, &ram);
+
+  if (d == NULL) return 0;
+  if (ram != NULL) {
+    memcpy(dict, d, s.img.size);
+    memcpy(tbforth_ram, ram, SNAPSHOT_RAM_BYTES);
+    munmap(ram, SNAPSHOT_RAM_BYTES);
+  }
+  munmap(d, sizeof(struct dict));
+  if (ram == NULL) return 0;
+  tbforth_snapshot_restore(&s);
   return 1;
 }
 
@@ -104,6 +283,162 @@ void load_ext_words (void) {
   MCU_WORDS();
 }
 
+/*
+  Streams: read-byte and write-byte go through per fd buffers (made the
+  first time an fd is used) instead of a syscall per byte. Writes go out
+  when the buffer fills, on flush-fd, close-file and close-tcp, before we
+  read or wait on the fd, and whenever the scheduler idles.
+*/
+#define STREAM_BUF 4096
+#define MAX_STREAMS 256		/* fds past this (or stdio's) aren't buffered */
+
+struct stream {
+  int rpos, rlen, wlen;
+  uint8_t rbuf[STREAM_BUF];
+  uint8_t wbuf[STREAM_BUF];
+};
+static struct stream *streams[MAX_STREAMS];
+static int nstreams;		/* highest fd with a stream + 1 */
+
+static struct stream *stream_get(int fd) {
+  if (fd <= 2 || fd >= MAX_STREAMS) return NULL;
+  if (streams[fd] == NULL && (streams[fd] = calloc(1, sizeof(struct stream))))
+    if (fd >= nstreams) nstreams = fd + 1;
+  return streams[fd];
+}
+
+static int stream_flush(int fd) {
+  struct stream *st = (fd >= 0 && fd < MAX_STREAMS) ? streams[fd] : NULL;
+  int n, off = 0;
+
+  if (st == NULL) return 0;
+  while (off < st->wlen) {
+    n = write(fd, st->wbuf + off, st->wlen - off);
+    if (n < 0 && errno == EINTR) continue;
+    if (n <= 0) {
+      st->wlen = 0;
+      return -1;
+    }
+    off += n;
+  }
+  st->wlen = 0;
+  return 0;
+}
+
+static void stream_flush_all(void) {
+  int fd;
+  for (fd = 0; fd < nstreams; fd++)
+    if (streams[fd] && streams[fd]->wlen) stream_flush(fd);
+  fflush(OUTFP);
+}
+
+/* Forget fd's buffers (it is being closed or seeked). */
+static void stream_drop(int fd, int keep) {
+  if (fd < 0 || fd >= MAX_STREAMS || streams[fd] == NULL) return;
+  stream_flush(fd);
+  streams[fd]->rpos = streams[fd]->rlen = 0;
+  if (!keep) {
+    free(streams[fd]);
+    streams[fd] = NULL;
+  }
+}
+
+static int stream_buffered(int fd) {
+  return fd >= 0 && fd < MAX_STREAMS && streams[fd] &&
+    streams[fd]->rpos < streams[fd]->rlen;
+}
+
+static int stream_readb(int fd) {
+  struct stream *st = stream_get(fd);
+  uint8_t b;
+  int n;
+
+  if (st == NULL)
+    return read(fd, &b, 1) == 1 ? b : -1;
+  if (st->rpos == st->rlen) {
+    if (st->wlen) stream_flush(fd);
+    do n = read(fd, st->rbuf, STREAM_BUF); while (n < 0 && errno == EINTR);
+    if (n <= 0) return -1;
+    st->rpos = 0;
+    st->rlen = n;
+  }
+  return st->rbuf[st->rpos++];
+}
+
+static int stream_writeb(int fd, uint8_t b) {
+  struct stream *st = stream_get(fd);
+
+  if (st == NULL)
+    return write(fd, &b, 1);
+  if (st->wlen == STREAM_BUF && stream_flush(fd) < 0)
+    return -1;
+  st->wbuf[st->wlen++] = b;
+  return 1;
+}
+
+static int stream_read(int fd, char *buf, int len) {
+  struct stream *st = (fd >= 0 && fd < MAX_STREAMS) ? streams[fd] : NULL;
+  int n;
+
+  if (st && st->rpos < st->rlen) {
+    n = st->rlen - st->rpos;
+    if (n > len) n = len;
+    memcpy(buf, st->rbuf + st->rpos, n);
+    st->rpos += n;
+    return n;
+  }
+  if (st && st->wlen) stream_flush(fd);
+  return read(fd, buf, len);
+}
+
+static int stream_write(int fd, char *buf, int len) {
+  struct stream *st = (fd >= 0 && fd < MAX_STREAMS) ? streams[fd] : NULL;
+
+  if (st && st->wlen + len <= STREAM_BUF) {
+    memcpy(st->wbuf + st->wlen, buf, len);
+    st->wlen += len;
+    return len;
+  }
+  if (stream_flush(fd) < 0) return -1;
+  return write(fd, buf, len);
+}
+
+#ifdef __linux__
+/*
+  The reactor: tasks parked with wait-readable/wait-writable sit in an
+  epoll set (one shot, tagged with task and fd) until the scheduler idles.
+  Then we wake just the ones that are ready.
+*/
+static int epfd = -1;
+
+static int reactor_add(int fd, int events, int task) {
+  struct epoll_event ev;
+
+  if (epfd < 0 && (epfd = epoll_create1(EPOLL_CLOEXEC)) < 0)
+    return 0;
+  ev.events = EPOLLONESHOT | ((events & 1) ? EPOLLIN : 0) |
+    ((events & 2) ? EPOLLOUT : 0);
+  ev.data.u64 = ((uint64_t)task << 32) | (uint32_t)fd;
+  if (epoll_ctl(epfd, EPOLL_CTL_MOD, fd, &ev) == 0)
+    return 1;
+  return epoll_ctl(epfd, EPOLL_CTL_ADD, fd, &ev) == 0;
+}
+
+static void reactor_idle(int ms) {
+  struct epoll_event evs[64];
+  int i, n;
+
+  stream_flush_all();
+  if (epfd < 0) {
+    poll(NULL, 0, ms);
+    return;
+  }
+  n = epoll_wait(epfd, evs, 64, ms);
+  for (i = 0; i < n; i++)
+    tbforth_wake(evs[i].data.u64 >> 32, (uint32_t)evs[i].data.u64);
+}
+#endif
+
 tbforth_stat c_handle(void) {
   RAMC r2, r1 = dpop();
   FILE *fp;
@@ -139,15 +474,38 @@ tbforth_stat c_handle(void) {
     }
     break;	
   case OS_MS:		/* milliseconds */
+    dpush((now_ns() - start_ns) / 1000000);
+    break;
+  case OS_US:		/* microseconds */
+    dpush((now_ns() - start_ns) / 1000);
+    break;
+  case OS_NS:
+    dpush64(now_ns());
+    break;
+  case OS_CYCLES:
+    dpush64(cycles());
+    break;
+#ifdef __linux__
+  case OS_IDLE:			/* nothing to run for ms */
+    reactor_idle(dpop());
+    break;
+  case OS_WAIT_FD:
     {
-      struct timeval tv;
-      gettimeofday(&tv,0);
-      tv.tv_sec -= start_tv.tv_sec;
-      tv.tv_usec -= start_tv.tv_usec;
-      r2 = (tv.tv_sec * 1000) + (tv.tv_usec/1000);
-      dpush(r2);
+      int fd = dpop();
+      int events = dpop();
+      stream_flush(fd);
+      if ((events & 1) && stream_buffered(fd))
+	dtop() = 0;		/* already have something to read */
+      else
+	dtop() = reactor_add(fd, events, dtop());
     }
     break;
+#else
+  case OS_IDLE:			/* nothing to run for ms */
+    stream_flush_all();
+    poll(NULL, 0, dpop());
+    break;
+#endif
   case OS_EMIT:			/* emit */
     txc(dpop()&0xff);
     break;
@@ -157,16 +515,20 @@ tbforth_stat c_handle(void) {
   case OS_SAVE_IMAGE:			/* save image */
     {
       int dict_size= (dict_here());
+      NATIVE_OFF();
       char *s = tbforth_next_word();
-      strncpy(buf, s, tbforth_iram->tibwordlen+1);
-      buf[(tbforth_iram->tibwordlen)+1] = '\0';
+      strncpy(buf, s, tbforth_iram->tibwordlen);
+      buf[tbforth_iram->tibwordlen] = '\0';
 
       char *hfile = malloc(strlen(buf) + 3);
       strcpy(hfile,buf);
 
-      config_open_w(hfile);
-      config_write((char*)dict, dict_size*4);
-      config_close();
+      if (!image_save(hfile)) {
+	printf("Can't save %s\n", hfile);
+	free(hfile);
+	NATIVE_ON();
+	return E_ABORT;
+      }
       
       strcat(hfile,".h");
       printf("Saving dictionary into %s\n", hfile);
@@ -183,25 +545,65 @@ tbforth_stat c_handle(void) {
       fprintf(fp, "0x%0X",dict->d[dict_size-1]);
       fprintf(fp,"\n}};\n");
       fclose(fp);
+      NATIVE_ON();
     }
     break;
-  case OS_READB:
+  case OS_SAVE_SNAPSHOT:
+  case OS_LOAD_SNAPSHOT:
     {
-      int b;
-      r2=dpop();
-      if (read(r2,&b,1) == -1) {
-	dpush(-1);
-      } else {
-	dpush(b);
+      char *s = tbforth_next_word();
+      strncpy(buf, s, tbforth_iram->tibwordlen);
+      buf[tbforth_iram->tibwordlen] = '\0';
+      if (r1 == OS_SAVE_SNAPSHOT) {
+	NATIVE_OFF();
+	r2 = snapshot_save(buf);
+	NATIVE_ON();
+	if (!r2) {
+	  printf("Can't save %s\n", buf);
+	  return E_ABORT;
+	}
+	break;
       }
+      stream_flush_all();
+      NATIVE_OFF();
+      if (!snapshot_load(buf)) {
+	printf("Can't load snapshot %s\n", buf);
+	NATIVE_ON();
+	return E_ABORT;
+      }
+      NATIVE_ON();
+      return E_EXIT;		/* the interpreter starts over */
     }
+  case OS_READB:		/* byte or -1 */
+    r2=dpop();
+    dpush(stream_readb(r2));
     break;
   case OS_WRITEB:
-    {
-      char b;
-      r2=dpop();
-      b=dpop();
-      dpush(write(r2,&b,1));
+    r2=dpop();
+    r1=dpop();
+    dpush(stream_writeb(r2, r1));
+    break;
+  case OS_PROFILE_SAMPLE:
+    r1 = dpop();
+#ifdef TBFORTH_PROFILE
+    profile_sample(r1);
+#endif
+    break;
+  case OS_FLUSH:
+    r1 = dpop();
+    if (r1 == 1)
+      fflush(OUTFP);
+    else
+      stream_flush(r1);
+    break;
+  case OS_TYPE:
+    r1 = dpop();		/* count */
+    r2 = dpop();		/* addr */
+    if ((int32_t)r1 > 0) {
+      if (r2 & 0x80000000)
+	txs((char*)&tbforth_ram[r2 & 0x7FFFFFFF], r1);
+      else
+	txs((char*)&tbforth_dict[r2], r1);
     }
     break;
   case OS_READBUF:
@@ -215,7 +617,7 @@ tbforth_stat c_handle(void) {
       } else {
 	buf = (char*)&tbforth_dict[r3];
       }
-      dpush(read(r1, buf, r2));
+      dpush(stream_read(r1, buf, r2));
     }
     break;
   case OS_WRITEBUF:
@@ -229,11 +631,13 @@ tbforth_stat c_handle(void) {
       } else {
 	buf = (char*)&tbforth_dict[r3];
       }
-      dpush(write(r1, buf, r2));
+      dpush(stream_write(r1, buf, r2));
     }
     break;
   case OS_CLOSE:
-    close(dpop());
+    r1 = dpop();
+    stream_drop(r1, 0);
+    close(r1);
     break;
   case OS_TCP_CONN:
     {
@@ -275,6 +679,7 @@ tbforth_stat c_handle(void) {
   case OS_TCP_DISCONN:
     {
       r1 = dpop();
+      stream_drop(r1, 0);
       close(r1);
       uint64_t r164 = (uint64_t)dpop() & 0xFFFFFFFF;
       uint64_t r264 = (uint64_t)dpop();
@@ -323,27 +728,18 @@ tbforth_stat c_handle(void) {
     {
       r1=dpop();		/* fd */
       r2=dpop();		/* offset */
+      stream_drop(r1, 1);
       dpush(lseek(r1,r2, SEEK_SET));
     }
     break;
   case OS_INCLUDE:			/* include */
     {
-      int interpret_from(FILE *fp);
+      int load_f(char *fname);
       char *s = tbforth_next_word();
       strncpy(buf,s, tbforth_iram->tibwordlen+1);
       buf[tbforth_iram->tibwordlen] = '\0';
-      printf("   Loading %s\n",buf);
-      fp = fopen(buf, "r");
-      if (fp != NULL) {
-	int stat = interpret_from(fp);
-	fclose(fp);
-	INFP = stdin;
-	if (stat != 0)
-	  return E_ABORT;
-      } else {
-	printf("File not found: <%s>\n", buf);
+      if (load_f(buf) != U_OK)
 	return E_ABORT;
-      }
     }  
     break;
   }
@@ -351,108 +747,228 @@ tbforth_stat c_handle(void) {
 }
 
 
-static char linebuf[128];
-char *line;
+/*
+  Report an error from interpreting line (len bytes, lineno or 0).
+  Returns stat, or U_OK if it wasn't one.
+*/
+static tbforth_stat report(tbforth_stat stat, char *line, size_t len,
+			   int lineno) {
+  char *tib = TBFORTH_TIB;
+  RAMC widx = tbforth_iram->tibwordidx, wlen = tbforth_iram->tibwordlen;
+  RAMC end = tbforth_iram->tibclen;
+
+  switch(stat) {
+  case E_NOT_A_WORD:
+  case E_NOT_A_NUM:
+    if (lineno)
+      fprintf(stdout," line: %d: ", lineno);
+    if (end > 0 && tib[end-1] == '\n') end--;
+    txs0("Huh? >>> ");
+    txs(&tib[widx], wlen);
+    txs0(" <<< ");
+    txs(&tib[widx + wlen], end - (widx + wlen));
+    txs0("\r\n");
+    break;
+  case E_ABORT:
+    if (len > 0 && line[len-1] == '\n') len--;
+    txs0("Abort!:<"); txs(line, len); txs0(">\n");
+    break;
+  case E_STACK_UNDERFLOW:
+    txs0("Stack underflow!\n");
+    break;
+  case E_DSTACK_OVERFLOW:
+    txs0("Stack overflow!\n");
+    break;
+  case E_RSTACK_OVERFLOW:
+    txs0("Return Stack overflow!\n");
+    break;
+  case E_EXIT:
+  case U_OK:
+    return U_OK;
+  default:
+    txs0("Ugh\n");
+    break;
+  }
+  return stat;
+}
+
+/*
+  Interpret fp a line at a time: 0 at the end of input, else the status
+  of the first error (once reported).
+*/
 int interpret_from(FILE *fp) {
-  int stat;
+  tbforth_stat stat = U_OK;
   int16_t lineno = 0;
+  char *line, *buf = NULL;
+  size_t cap = 0;
+  ssize_t len;
+
   INFP = fp;
-  while (!feof(fp)) {
+  while (stat == U_OK) {
     ++lineno;
-    if (fp == stdin) txs0(" ok\r\n");
-    if (fp == stdin) {
-      line=rl_gets(); if (line==NULL) return (0);
+    if (fp == stdin && !batch) {
+      txs0(" ok\r\n");
+      line=rl_gets(); if (line==NULL) break;
+      len = strlen(line);
     } else {
-      if (fgets(linebuf,128,fp) == NULL) break;
-      line = linebuf;
+      if ((len = getline(&buf, &cap, fp)) < 0) break;
+      line = buf;
     }
     if (line[0] == '\n' || line[0] == '\0') continue;
-    stat = tbforth_interpret(line);
-    switch(stat) {
-    case E_NOT_A_WORD:
-    case E_NOT_A_NUM:
-      if (fp != stdout)
-	fprintf(stdout," line: %d: ", lineno);
-      txs0("Huh? >>> ");
-      txs(&tbforth_iram->tib[tbforth_iram->tibwordidx],tbforth_iram->tibwordlen);
-      txs0(" <<< ");
-      txs(&tbforth_iram->tib[tbforth_iram->tibwordidx + tbforth_iram->tibwordlen],
-	  tbforth_iram->tibclen - 
-	  (tbforth_iram->tibwordidx + tbforth_iram->tibwordlen));
-      txs0("\r\n");
-      return -1;
-    case E_ABORT:
-      txs0("Abort!:<"); txs0(line); txs0(">\n");
-      return -1;
-    case E_STACK_UNDERFLOW:
-      txs0("Stack underflow!\n");
-      return -1;
-    case E_DSTACK_OVERFLOW:
-      txs0("Stack overflow!\n");
-      return -1;
-    case E_RSTACK_OVERFLOW:
-      txs0("Return Stack overflow!\n");
-      return -1;
-    case U_OK:
-      break;
-    default:
-      txs0("Ugh\n");
-      return -1;
-    }
+    stat = report(tbforth_interpret_src(line, len), line, len, lineno);
   }
-  return 0;
+  free(buf);
+  return stat;
 }
 
-#include <sys/types.h>
-#include <sys/stat.h>
-
+/*
+  Load (include) a file: it's mapped and each line interpreted where it
+  is, so nothing is copied and lines can be any length. Files that can't
+  be mapped (pipes, etc) are read a line at a time.
+*/
 int load_f (char* fname) {
-  int stat = -1;
+  tbforth_stat stat = U_OK;
+  char *src = NULL, *line, *nl;
+  struct stat st;
+  int lineno = 0;
+  size_t len;
+  int fd;
   FILE *fp;
-  printf("   Loading %s\n",fname);
-  fp = fopen(fname, "r");
-  if (fp != NULL)  {
-    stat=interpret_from(fp);
+
+  if (!batch) printf("   Loading %s\n",fname);
+  if ((fd = open(fname, O_RDONLY)) < 0) {
+    fprintf(stderr, "File not found: <%s>\n", fname);
+    return E_ABORT;
   }
-  fclose(fp);
+  if (fstat(fd, &st) < 0 || !S_ISREG(st.st_mode) ||
+      (st.st_size > 0 &&
+       (src = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) ==
+       MAP_FAILED)) {
+    if ((fp = fdopen(fd, "r")) == NULL) {
+      close(fd);
+      return E_ABORT;
+    }
+    stat = interpret_from(fp);
+    fclose(fp);
+    INFP = stdin;
+    return stat;
+  }
+  close(fd);
+  if (st.st_size == 0) return U_OK;
+  madvise(src, st.st_size, MADV_SEQUENTIAL);
+  for (line = src; stat == U_OK && line < src + st.st_size; line = nl) {
+    ++lineno;
+    nl = memchr(line, '\n', src + st.st_size - line);
+    nl = nl ? nl + 1 : src + st.st_size;
+    len = nl - line;
+    if (line[0] == '\n') continue;
+    stat = report(tbforth_interpret_src(line, len), line, len, lineno);
+  }
+  munmap(src, st.st_size);
   return stat;
 }
 
+/* Is fname an image or snapshot (rather than a script)? */
+static bool is_image(char *fname) {
+  uint32_t magic = 0;
+  int fd = open(fname, O_RDONLY);
+
+  if (fd < 0) return 0;
+  if (read(fd, &magic, sizeof(magic)) != sizeof(magic)) magic = 0;
+  close(fd);
+  return magic == IMAGE_MAGIC || magic == SNAPSHOT_MAGIC;
+}
 
 const char* history_file = ".tbforth_history";
+/*
+  tbforth-posix [image] [-e code | file | -]...
+
+  With no code, files or - (stdin), and stdin a terminal, this is the
+  interactive console. Otherwise it runs in batch mode: each argument in
+  turn (or stdin when there are none) with no readline, prompt, banner or
+  per line flushing, stopping at the first error. The exit status is 0 or
+  that error's tbforth_stat.
+*/
 int main(int argc, char* argv[]) {
+  struct tbforth_snapshot snap;
+  RAMC *ram = NULL;
   int stat = -1;
-  dict = malloc(sizeof(struct dict));
-  dict->version = DICT_VERSION;
-  dict->word_size = sizeof(CELL);
-  dict->max_cells = MAX_DICT_CELLS;
-  dict->here =  0;
-  dict->last_word_idx = 0;
-  dict->varidx = 1;
+  int argi = 1;
+
+  if (argc > 1 && is_image(argv[1])) {
+    if ((dict = image_map(argv[1], &snap, &ram)) == NULL) {
+      fprintf(stderr, "Can't load image %s (damaged or not for this build)\n", argv[1]);
+      exit(1);
+    }
+    argi = 2;
+  } else {
+#ifdef EMBED_IMAGE
+    dict = &flashdict;
+#else
+    dict = malloc(sizeof(struct dict));
+    dict->version = DICT_VERSION;
+    dict->word_size = sizeof(CELL);
+    dict->max_cells = MAX_DICT_CELLS;
+    dict->here =  0;
+    dict->last_word_idx = 0;
+    dict->varidx = 1;
+#endif
+  }
+  batch = argi < argc || !isatty(0);
 
-  gettimeofday(&start_tv,0);
+  start_ns = now_ns();
+  atexit(stream_flush_all);
+#ifdef TBFORTH_OPSTATS
+  atexit(opstats_at_exit);
+#endif
 
-  read_history(history_file);
+  if (!batch) read_history(history_file);
 
-  tbforth_init();
+  if (ram != NULL) {
+    tbforth_ram = ram;
+    tbforth_snapshot_restore(&snap);
+  } else {
+    tbforth_init();
+  }
+  NATIVE_ON();
+#ifdef TBFORTH_JIT
+  /* calls before a word is compiled, 0: no JIT */
+  if (getenv("TBFORTH_JIT")) tbforth_jit_threshold(atoi(getenv("TBFORTH_JIT")));
+#endif
 
   OUTFP = stdout;
   INFP = stdin;
 
-  if (argc < 2) {
+#ifndef EMBED_IMAGE
+  if (dict->here == 0) {
     tbforth_load_prims();
     stat = load_f("./core.f");
     load_ext_words();
     if (stat == 0) stat = load_f("./util.f");
-  } else {
-    if (config_open_r(argv[1])) {
-      if (!config_read((char*)dict))
-	exit(1);
-      config_close();
-      stat = 0;
+  } else
+#endif
+    stat = 0;
+  if (stat == 0 && ram == NULL) stat=tbforth_interpret("init");
+
+  if (batch) {
+    if (argi == argc) return interpret_from(stdin);
+    for (; stat == 0 && argi < argc; argi++) {
+      if (strcmp(argv[argi], "-e") == 0 && argi + 1 < argc) {
+	argi++;
+	stat = tbforth_interpret_src(argv[argi], strlen(argv[argi]));
+	if (stat != U_OK && stat != E_EXIT)
+	  fprintf(stderr, "Error %d in -e '%s'\n", stat, argv[argi]);
+	else
+	  stat = 0;
+      } else if (strcmp(argv[argi], "-") == 0) {
+	stat = interpret_from(stdin);
+      } else {
+	stat = load_f(argv[argi]);
+      }
     }
+    return stat;
   }
-  if (stat == 0) stat=tbforth_interpret("init");
+
   if (stat == 0) stat=tbforth_interpret("cr memory cr");
   do {
     INFP = stdin;
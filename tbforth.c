@@ -66,38 +66,63 @@ RAMC fixed_pt_mult (double num) {
 
 
 tbforth_stat interpret_tib(void);
+tbforth_stat exec(CELL ip, bool toplevelprim, uint8_t last_exec_rdix);
 
-CELL *tbforth_dict;			/* treat dict struct like array */
-abort_t _tbforth_abort_request;	/* for emergency aborts */
+/*
+  The current interpreter instance (see struct tbforth_vm).
+*/
+static RAMC tbforth_default_ram[TOTAL_RAM_CELLS];
+static struct tbforth_vm tbforth_default_vm;
+
+TBFORTH_TLS struct tbforth_vm *tbforth_cur_vm = &tbforth_default_vm;
+TBFORTH_TLS RAMC *tbforth_ram = tbforth_default_ram;
+TBFORTH_TLS CELL *tbforth_dict;		/* treat dict struct like array */
+TBFORTH_TLS abort_t _tbforth_abort_request;	/* for emergency aborts */
+TBFORTH_TLS char *tbforth_src;		/* see tbforth_interpret_src() */
+
+TBFORTH_TLS struct tbforth_iram *tbforth_iram;
+TBFORTH_TLS struct tbforth_uram *tbforth_uram;
+/* The current instance's native words (see native_find()) */
+static TBFORTH_TLS struct tbforth_natives *natives = &tbforth_default_vm.natives;
+static void native_written(RAMC lo, RAMC hi);
+static void native_written_bytes(const char *p, RAMC n);
+/* Everything that writes the dictionary goes through these */
+#define NATIVE_WRITTEN(a,n) \
+  ((RAMC)(a) < natives->hi ? native_written(a, (RAMC)(a) + (n)) : (void)0)
+#define NATIVE_WRITTEN_BYTES(p,n) (natives->hi ? native_written_bytes(p, n) : (void)0)
 
-struct tbforth_iram *tbforth_iram;
-struct tbforth_uram *tbforth_uram;
+// Fix me... this is not in uram.. probably should be.
+//
+static TBFORTH_TLS char* A_REG;		/* (char) address register */
+static TBFORTH_TLS char* B_REG;		/* (char) address register */
 
 #ifdef GUARD_RAILS
-inline void DICT_WRITE(CELL a, RAMC v) {
+static inline void DICT_WRITE(CELL a, RAMC v) {
   if(a >= 0 && a < MAX_DICT_CELLS) {
     dict_write(a,v);
   } else {
     tbforth_abort_request(ABORT_ILLEGAL);
   }
 }
-inline void RAM_WRITE(CELL a, RAMC v) {
+static inline void RAM_WRITE(CELL a, RAMC v) {
   if(a >= 0 && a < TOTAL_RAM_CELLS) {
     tbforth_ram[a]=v;
   }else {
     tbforth_abort_request(ABORT_ILLEGAL);
   }
 }
-inline void DICT_APPEND(CELL c) {
+static inline void DICT_APPEND(CELL c) {
   if (dict->here < MAX_DICT_CELLS) {
+    NATIVE_WRITTEN(dict->here, 1);
     dict_append(c);
   } else {
     tbforth_abort_request(ABORT_ILLEGAL);
   }
 }    
 
-inline void DICT_APPEND_STRING(char*s, RAMC l) {
+static inline void DICT_APPEND_STRING(char*s, RAMC l) {
   if (dict->here < MAX_DICT_CELLS) {
+    NATIVE_WRITTEN(dict->here, l/BYTES_PER_CELL + l%BYTES_PER_CELL);
     dict_append_string(s,l);
   } else {
     tbforth_abort_request(ABORT_ILLEGAL);
@@ -106,8 +131,11 @@ inline void DICT_APPEND_STRING(char*s, RAMC l) {
 #else
 #define DICT_WRITE(a,v) dict_write(a,v)
 #define RAM_WRITE(a,v) tbforth_ram[a]=v
-#define DICT_APPEND(c) dict_append(c)
-#define DICT_APPEND_STRING(s,l) dict_append_string(s,l)
+#define DICT_APPEND(c) (NATIVE_WRITTEN(dict->here, 1), dict_append(c))
+#define DICT_APPEND_STRING(s,l) do {					\
+    NATIVE_WRITTEN(dict->here, (l)/BYTES_PER_CELL + (l)%BYTES_PER_CELL);	\
+    dict_append_string(s,l);						\
+  } while (0)
 #endif
 
 
@@ -117,10 +145,9 @@ inline void DICT_APPEND_STRING(char*s, RAMC l) {
 #define WORD_LEN_BITS 0x3F  
 #define IMMEDIATE_BIT (1<<7)
 #define PRIM_BIT     (1<<6)
+#define INLINE_BIT   (1<<8)	/* compiled by copying its body (see inline_end()) */
 
 
-RAMC tbforth_ram[TOTAL_RAM_CELLS];
-
 void tbforth_cdef (char* name, int val) {
   snprintf(PAD_STR, PAD_SIZE_BYTES, ": %s %d cf ;", name, val);
   tbforth_interpret(PAD_STR);
@@ -215,6 +242,99 @@ char* u32toa(uint32_t value, char* result, int32_t base) {
 
 CELL find_word(char* s, uint8_t len, RAMC* addr, bool *immediate, char *prim);
 
+#define HEAD_LEN(h) (tbforth_dict[(h)+1] & WORD_LEN_BITS)
+#define HEAD_NAME(h) ((char*)(tbforth_dict+(h)+2))
+
+#ifdef DICT_HASH_SLOTS
+/*
+  Hash index of word names to word headers, so find_word() doesn't have to
+  strncmp() its way through the whole dictionary for every token (and
+  every number!).
+
+  It is just a RAM cache of the dictionary's linked list. Each slot holds
+  the newest header with that name. The dictionary only grows up, so a
+  higher header index is always the newer (shadowing) definition.
+
+  The index remembers which last_word_idx it reflects. New words (make_word)
+  are added as they are created. If last_word_idx moves anywhere else
+  (forget-to-mark, loading an image, cold, etc) we just rebuild it.
+*/
+static TBFORTH_TLS struct dict_index *dict_index = &tbforth_default_vm.index;
+
+static CELL dict_hash(char *s, uint8_t len) {
+  uint32_t h = 2166136261u;	/* FNV-1a */
+  while (len--) h = (h ^ (uint8_t)*s++) * 16777619u;
+  return h & (DICT_HASH_SLOTS-1);
+}
+
+static bool dict_index_add(CELL head) {
+  uint8_t len = HEAD_LEN(head);
+  char *name = HEAD_NAME(head);
+  CELL h, i = dict_hash(name, len);
+
+  while ((h = dict_index->slot[i]) != 0) {
+    if (HEAD_LEN(h) == len && strncmp(name, HEAD_NAME(h), len) == 0) {
+      if (head > h) dict_index->slot[i] = head; /* newest wins */
+      return 1;
+    }
+    i = (i+1) & (DICT_HASH_SLOTS-1);
+  }
+  if (dict_index->count >= (DICT_HASH_SLOTS/4)*3) {
+    dict_index->full = 1;
+    return 0;
+  }
+  dict_index->slot[i] = head;
+  dict_index->count++;
+  return 1;
+}
+
+void dict_index_invalidate(void) {
+  dict_index->valid = 0;
+  dict_index->full = 0;
+}
+
+static bool dict_index_sync(void) {
+  CELL h = dict->last_word_idx;
+
+  if (dict_index->full) return 0;
+  if (dict_index->valid) {
+    if (h == dict_index->last) return 1;
+    /* Just some new words? Then they are chained down to "last". */
+    while (h > dict_index->last && dict_index_add(h)) h = tbforth_dict[h];
+    if (h == dict_index->last) {
+      dict_index->last = dict->last_word_idx;
+      return 1;
+    }
+    if (dict_index->full) return 0;
+  }
+  memset(dict_index->slot, 0, sizeof(dict_index->slot));
+  dict_index->count = 0;
+  for (h = dict->last_word_idx; h != 0; h = tbforth_dict[h]) {
+    if (!dict_index_add(h)) return 0;
+  }
+  dict_index->last = dict->last_word_idx;
+  dict_index->valid = 1;
+  return 1;
+}
+
+static CELL dict_index_find(char *s, uint8_t slen) {
+  CELL h, i = dict_hash(s, slen);
+  while ((h = dict_index->slot[i]) != 0) {
+    if (HEAD_LEN(h) == slen && strncmp(s, HEAD_NAME(h), slen) == 0)
+      return h;
+    i = (i+1) & (DICT_HASH_SLOTS-1);
+  }
+  return 0;
+}
+#define DICT_INDEX_ADD(head, prev_last) \
+  if (dict_index->valid && dict_index->last == prev_last && dict_index_add(head)) \
+    dict_index->last = head
+#define DICT_INDEX_INVALIDATE() dict_index_invalidate()
+#else
+#define DICT_INDEX_ADD(head, prev_last)
+#define DICT_INDEX_INVALIDATE()
+#endif
+
 /*
  Every entry in the dictionary consists of the following cells:
   [index of previous entry]  
@@ -223,42 +343,442 @@ CELL find_word(char* s, uint8_t len, RAMC* addr, bool *immediate, char *prim);
 */
 void make_word(char *str, uint8_t str_len) {
   CELL my_head = dict_here();
+  CELL prev_last = dict->last_word_idx;
 
-  DICT_APPEND(dict->last_word_idx);
+  DICT_APPEND(prev_last);
   DICT_APPEND(str_len);
   DICT_APPEND_STRING(str, str_len);
   dict_set_last_word(my_head);
-
+  DICT_INDEX_ADD(my_head, prev_last);
 }
 
 void make_immediate(void) {
-  DICT_WRITE((dict->last_word_idx+1), tbforth_dict[dict->last_word_idx+1]|IMMEDIATE_BIT);
+  DICT_WRITE((dict->last_word_idx+1),
+	     (tbforth_dict[dict->last_word_idx+1]|IMMEDIATE_BIT) & ~INLINE_BIT);
 }
 
 char next_char(void) {
   if (tbforth_iram->tibidx >= tbforth_iram->tibclen) return 0;
-  return tbforth_iram->tib[tbforth_iram->tibidx++];
+  return TBFORTH_TIB[tbforth_iram->tibidx++];
 }
 #define EOTIB() (tbforth_iram->tibidx >= tbforth_iram->tibclen)
-#define CURR_TIB_WORD &(tbforth_iram->tib[tbforth_iram->tibwordidx])
+#define CURR_TIB_WORD &(TBFORTH_TIB[tbforth_iram->tibwordidx])
 #define CLEAR_TIB() (tbforth_iram->tibidx=0, tbforth_iram->tibclen=0, tbforth_iram->tibwordlen=0, tbforth_iram->tibwordidx=0)
 
+/* Words end at a space, a NUL or the end of the source (no terminator needed) */
 char* tbforth_next_word (void) {
-  char nc; uint8_t cnt = 0;
-  do { nc = next_char(); } while (!EOTIB() && isspace(nc));
-  if (EOTIB()) {
+  char *tib = TBFORTH_TIB;
+  RAMC idx = tbforth_iram->tibidx, end = tbforth_iram->tibclen;
+
+  while (idx < end && isspace((unsigned char)tib[idx])) idx++;
+  if (idx >= end || tib[idx] == '\0') {
+    tbforth_iram->tibidx = end;
     return "";
   }
-  cnt=1;
-  tbforth_iram->tibwordidx = (tbforth_iram->tibidx)-1;
-  while(!isspace(next_char()) && !EOTIB()) ++cnt;
-  tbforth_iram->tibwordlen = cnt;
-  return &(tbforth_iram->tib[tbforth_iram->tibwordidx]);
+  tbforth_iram->tibwordidx = idx;
+  while (idx < end && tib[idx] != '\0' && !isspace((unsigned char)tib[idx]))
+    idx++;
+  tbforth_iram->tibwordlen = idx - tbforth_iram->tibwordidx;
+  tbforth_iram->tibidx = idx < end ? idx + 1 : end; /* past the delimiter */
+  return &tib[tbforth_iram->tibwordidx];
 }
 
 
 typedef tbforth_stat (*wfunct_t)(void);
 
+/*
+  Scheduler (see struct tbforth_sched). The ready ring holds exactly the
+  READY tasks, so everything but an abort is O(1). Task 0 (the interpreter)
+  never suspends or ends, so whenever another task gives up the CPU there
+  is somebody ready to take it.
+*/
+static TBFORTH_TLS struct tbforth_sched *sched = &tbforth_default_vm.sched;
+
+#define TASK_URAM(t) ((struct tbforth_uram*)&tbforth_ram[sched->uram[t]])
+
+static void sched_init(void) {
+  memset(sched, 0, sizeof(*sched));
+  sched->uram[0] = (RAMC*)tbforth_uram - tbforth_ram;
+  sched->state[0] = TASK_RUNNING;
+}
+
+static void sched_ready(uint8_t t) {
+  sched->state[t] = TASK_READY;
+  sched->ready[(sched->head + sched->count++) & (MAX_TASKS-1)] = t;
+}
+
+static uint8_t sched_next(void) {
+  uint8_t t = sched->ready[sched->head];
+  sched->head = (sched->head + 1) & (MAX_TASKS-1);
+  sched->count--;
+  return t;
+}
+
+/*
+  Sleeping tasks: a binary heap ordered by wake up time (ms, wraps).
+  Put task t at heap slot i and move it up or down to where it belongs.
+*/
+#define EARLIER(a,b) ((int32_t)(sched->wake[a] - sched->wake[b]) < 0)
+
+static void sleeper_place(int i, uint8_t t) {
+  int c;
+  while (i > 0 && EARLIER(t, sched->sleeping[(i-1)/2])) {
+    sched->sleeping[i] = sched->sleeping[(i-1)/2];
+    i = (i-1)/2;
+  }
+  while ((c = 2*i+1) < sched->nsleep) {
+    if (c+1 < sched->nsleep && EARLIER(sched->sleeping[c+1], sched->sleeping[c]))
+      c++;
+    if (!EARLIER(sched->sleeping[c], t)) break;
+    sched->sleeping[i] = sched->sleeping[c];
+    i = c;
+  }
+  sched->sleeping[i] = t;
+}
+
+static uint8_t sleeper_remove(int i) {
+  uint8_t t = sched->sleeping[i];
+  uint8_t last = sched->sleeping[--sched->nsleep];
+  if (i < sched->nsleep) sleeper_place(i, last);
+  return t;
+}
+
+static void sched_sleep(RAMC when) {
+  uint8_t t = sched->current;
+  sched->state[t] = TASK_SLEEPING;
+  sched->wake[t] = when;
+  sleeper_place(sched->nsleep++, t);
+}
+
+/*
+  Ask the host (through c_handle, just like cf) for the time (OS_MS), or
+  to wait for up to ms (OS_IDLE). Both leave the stack as it was.
+*/
+static void sched_host(RAMC op) {
+  dpush(op);
+  if (tbforth_cur_vm->c_handle)
+    tbforth_cur_vm->c_handle(tbforth_cur_vm);
+  else
+    c_handle();
+}
+
+RAMC sched_now(void) {
+  RAMC didx = tbforth_uram->didx, r = 0;
+  sched_host(OS_MS);
+  if (tbforth_uram->didx != didx) r = dtop();
+  tbforth_uram->didx = didx;
+  return r;
+}
+
+static void sched_idle(RAMC ms) {
+  RAMC didx = tbforth_uram->didx;
+  dpush(ms);
+  sched_host(OS_IDLE);
+  tbforth_uram->didx = didx;
+}
+
+/*
+  Hand the current (WAITING) task's fd to the host. If it can't wait on
+  it (no OS_WAIT_FD, or not that kind of fd) the task just yields.
+*/
+static void sched_wait(void) {
+  RAMC didx = tbforth_uram->didx;
+  uint8_t t = sched->current;
+  int ok;
+
+  dpush(t);
+  dpush(sched->events);
+  dpush(sched->wake[t]);
+  sched_host(OS_WAIT_FD);
+  ok = tbforth_uram->didx == didx + 1 && dtop();
+  tbforth_uram->didx = didx;
+  if (!ok) {
+    sched->nwait--;
+    sched_ready(t);
+  }
+}
+
+/* Drop every task but the interpreter's (e.g. before reusing the RAM) */
+void tbforth_sched_reset(void) {
+  sched_init();
+}
+
+/*
+  The host says fd is ready (from OS_IDLE). Stale wake ups (the task has
+  moved on since) are ignored.
+*/
+void tbforth_wake(RAMC task, RAMC fd) {
+  if (task < MAX_TASKS && sched->state[task] == TASK_WAITING &&
+      sched->wake[task] == fd) {
+    sched->nwait--;
+    sched_ready(task);
+  }
+}
+
+#ifdef TBFORTH_PROFILE
+/*
+  Profiling. exec() calls prof_enter() on every call of a colon definition
+  and prof_leave() on every exit. Each task has a stack of frames (the
+  calls in progress) marked with the return stack index they were called
+  at, so an exit closes its own frame plus any a word left behind by
+  playing with the return stack. Time a task spends switched out isn't
+  counted against its frames. Recursion counts inclusive time twice.
+*/
+#ifndef PROFILE_CLOCK_NS
+#include <time.h>
+static uint64_t profile_clock_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+#define PROFILE_CLOCK_NS() profile_clock_ns()
+#endif
+#define PROFILE_DEPTH RS_CELLS
+
+struct prof_word {
+  CELL xt;			/* 0 = free slot */
+  uint32_t calls, samples;
+  uint64_t incl, excl;		/* ns */
+};
+
+struct prof_frame {
+  RAMC ridx;
+  uint16_t slot;
+  uint64_t t0, child;
+};
+
+static TBFORTH_TLS struct prof_word prof[PROFILE_SLOTS];
+static TBFORTH_TLS struct prof_word prof_sorted[PROFILE_SLOTS]; /* report */
+static TBFORTH_TLS struct prof_frame prof_stack[MAX_TASKS][PROFILE_DEPTH];
+static TBFORTH_TLS uint8_t prof_depth[MAX_TASKS];
+static TBFORTH_TLS uint64_t prof_out[MAX_TASKS]; /* when it was switched out */
+static TBFORTH_TLS volatile uint16_t prof_top = PROFILE_SLOTS; /* running */
+static TBFORTH_TLS bool prof_timing = 1;
+
+static uint16_t prof_slot(CELL xt) {
+  uint16_t i = (xt * 40503u) & (PROFILE_SLOTS-1), n;
+
+  for (n = 0; n < PROFILE_SLOTS; n++, i = (i+1) & (PROFILE_SLOTS-1)) {
+    if (prof[i].xt == xt) return i;
+    if (prof[i].xt == 0) {
+      prof[i].xt = xt;
+      return i;
+    }
+  }
+  return PROFILE_SLOTS;		/* full */
+}
+
+#define PROF_NOW() (prof_timing ? PROFILE_CLOCK_NS() : 0)
+
+static void prof_enter(CELL xt, RAMC ridx) {
+  uint8_t t = sched->current;
+  struct prof_frame *f;
+  uint16_t slot = prof_slot(xt);
+
+  if (prof_depth[t] == PROFILE_DEPTH || slot == PROFILE_SLOTS) return;
+  f = &prof_stack[t][prof_depth[t]++];
+  f->ridx = ridx;
+  f->slot = slot;
+  f->child = 0;
+  f->t0 = PROF_NOW();
+  prof[slot].calls++;
+  prof_top = slot;
+}
+
+static void prof_leave(RAMC ridx) {
+  uint8_t t = sched->current;
+  uint64_t now = PROF_NOW(), d;
+  struct prof_frame *f;
+
+  while (prof_depth[t] && prof_stack[t][prof_depth[t]-1].ridx <= ridx) {
+    f = &prof_stack[t][--prof_depth[t]];
+    if (now == 0 || f->t0 == 0) continue; /* not timing (sampling) */
+    d = now - f->t0;
+    prof[f->slot].incl += d;
+    prof[f->slot].excl += d - f->child;
+    if (prof_depth[t]) prof_stack[t][prof_depth[t]-1].child += d;
+  }
+  prof_top = prof_depth[t] ? prof_stack[t][prof_depth[t]-1].slot : PROFILE_SLOTS;
+}
+
+/* Task from is switched out for task to */
+static void prof_switch(uint8_t from, uint8_t to) {
+  uint64_t now = PROF_NOW();
+  uint8_t i;
+
+  prof_out[from] = now;
+  for (i = 0; now && prof_out[to] && i < prof_depth[to]; i++)
+    if (prof_stack[to][i].t0) prof_stack[to][i].t0 += now - prof_out[to];
+  prof_top = prof_depth[to] ? prof_stack[to][prof_depth[to]-1].slot : PROFILE_SLOTS;
+}
+
+/* From a signal handler (SIGPROF, etc): count a sample of the running word */
+void tbforth_profile_sample(void) {
+  if (prof_top < PROFILE_SLOTS) prof[prof_top].samples++;
+}
+
+/* Sampling alone doesn't need the clock */
+void tbforth_profile_timing(bool on) {
+  prof_timing = on;
+}
+
+/* Busiest first: by samples if there are any, else exclusive time */
+static int prof_cmp(const void *a, const void *b) {
+  const struct prof_word *x = a, *y = b;
+  if (x->samples != y->samples) return x->samples < y->samples ? 1 : -1;
+  return x->excl < y->excl ? 1 : x->excl > y->excl ? -1 : 0;
+}
+
+/*
+  (profile) ( n - xt calls excl-us incl-us samples t | f )
+  The nth busiest word or f. 0 takes a sorted copy (so the report
+  doesn't count itself) and -1 resets.
+*/
+static void profile_op(void) {
+  static TBFORTH_TLS uint16_t nwords;
+  int32_t n = dpop();
+  struct prof_word *w;
+  uint16_t i;
+
+  if (n < 0) {
+    memset(prof, 0, sizeof(prof));
+    memset(prof_depth, 0, sizeof(prof_depth));
+    prof_top = PROFILE_SLOTS;
+    nwords = 0;
+    dpush(0);
+    return;
+  }
+  if (n == 0) {
+    for (i = nwords = 0; i < PROFILE_SLOTS; i++)
+      if (prof[i].xt != 0) prof_sorted[nwords++] = prof[i];
+    qsort(prof_sorted, nwords, sizeof(prof_sorted[0]), prof_cmp);
+  }
+  if (n >= nwords) {
+    dpush(0);
+    return;
+  }
+  w = &prof_sorted[n];
+  dpush(w->xt);
+  dpush(w->calls);
+  dpush(w->excl / 1000);
+  dpush(w->incl / 1000);
+  dpush(w->samples);
+  dpush(-1);
+}
+# define PROFILE_CALL(xt) prof_enter(xt, RIDX())
+# define PROFILE_EXIT() prof_leave(RIDX())
+# define PROFILE_RESET(t) (prof_depth[t] = 0)
+#else
+static void profile_op(void) {
+  (void)dpop();
+  dpush(0);
+}
+# define PROFILE_CALL(xt) do {} while(0)
+# define PROFILE_EXIT() do {} while(0)
+# define PROFILE_RESET(t) do {} while(0)
+#endif
+
+/*
+  Switch tbforth_uram to the next ready task, waking up sleepers that
+  are due. If nobody is ready, let the host idle until the next one is.
+  While tasks wait on fds we also poll (idle 0) about once around the
+  ready ring.
+*/
+void sched_switch(void) {
+  uint8_t t;
+  RAMC now = 0;
+
+  if (sched->state[sched->current] == TASK_WAITING)
+    sched_wait();
+  else if (sched->state[sched->current] == TASK_RUNNING)
+    sched_ready(sched->current);
+  for (;;) {
+    if (sched->nsleep) {
+      now = sched_now();
+      while (sched->nsleep && (int32_t)(sched->wake[sched->sleeping[0]] - now) <= 0)
+	sched_ready(sleeper_remove(0));
+    }
+    if (sched->count) {
+      if (sched->nwait && ++sched->ticks > sched->count) {
+	sched->ticks = 0;
+	sched_idle(0);
+      }
+      break;
+    }
+    sched->ticks = 0;
+    sched_idle(sched->nsleep ? sched->wake[sched->sleeping[0]] - now : -1);
+  }
+  t = sched_next();
+#ifdef TBFORTH_PROFILE
+  prof_switch(sched->current, t);
+#endif
+  sched->current = t;
+  sched->state[t] = TASK_RUNNING;
+  tbforth_uram = TASK_URAM(t);
+}
+
+/*
+  Start xt as a new task on the uram at RAM cell a (sizes already set up,
+  see make-task). When xt returns it runs into (task-end).
+  Returns the task number or -1 (also when a isn't a uram make-task made:
+  its sizes must fit in it and in RAM).
+*/
+RAMC tbforth_spawn(RAMC xt, RAMC a) {
+  struct tbforth_uram *u = (struct tbforth_uram*)&tbforth_ram[a];
+  CELL end = find_word("(task-end)", 10, 0, 0, 0);
+  uint64_t need;
+  uint8_t t, free = 0;
+
+  if (a >= TOTAL_RAM_CELLS - 7) return -1;
+  need = 6 + (uint64_t)u->dsize + u->rsize;
+  if (u->len == 0 || u->rsize < 2 || need > u->len ||
+      a + need >= TOTAL_RAM_CELLS)
+    return -1;
+
+  for (t = 0; t < MAX_TASKS; t++) {
+    if (sched->state[t] == TASK_FREE) {
+      if (free == 0) free = t;
+    } else if (sched->uram[t] == a) {
+      return -1;		/* uram is already a task */
+    }
+  }
+  if (free == 0 || end == 0) return -1;
+  sched->uram[free] = a;
+  u->base = tbforth_uram->base;
+  u->fixedp = tbforth_uram->fixedp;
+  u->didx = -1;
+  u->ridx = u->dsize + u->rsize;
+  u->ds[--u->ridx] = end;
+  u->ds[--u->ridx] = xt;
+  PROFILE_RESET(free);
+  sched_ready(free);
+  return free;
+}
+
+/*
+  Aborting in a task kills it and puts us back on the interpreter (task 0).
+*/
+static void sched_abort(void) {
+  uint8_t i, n;
+
+  if (sched->current == 0) return;
+  sched->state[sched->current] = TASK_FREE;
+  if (sched->state[0] == TASK_SLEEPING) {
+    for (i = 0; sched->sleeping[i] != 0; i++);
+    sleeper_remove(i);
+  }
+  if (sched->state[0] == TASK_WAITING)
+    sched->nwait--;
+  for (i = n = 0; i < sched->count; i++) {
+    uint8_t t = sched->ready[(sched->head + i) & (MAX_TASKS-1)];
+    if (t != 0) sched->ready[(sched->head + n++) & (MAX_TASKS-1)] = t;
+  }
+  sched->count = n;
+  sched->current = 0;
+  sched->state[0] = TASK_RUNNING;
+  tbforth_uram = TASK_URAM(0);
+}
+
 
 void tbforth_init(void) {
   tbforth_dict = (CELL*)dict;
@@ -277,12 +797,165 @@ void tbforth_init(void) {
   tbforth_uram->fixedp = FIXED_PT_PLACES;
 #endif
 
+  DICT_INDEX_INVALIDATE();
+  sched_init();
   tbforth_abort_clr();
   tbforth_abort(0);
 
   tbforth_uram->base = 10;
 }
 
+/*
+  Saved images. The host writes the header then the first img->size bytes
+  of dict; before running an image it checks it was made for us.
+*/
+static uint32_t image_sum(uint8_t *p, uint32_t n) {
+  uint32_t h = 2166136261u;
+  while (n--)
+    h = (h ^ *p++) * 16777619u;
+  return h;
+}
+
+static uint8_t image_little_endian(void) {
+  uint16_t one = 1;
+  return *(uint8_t*)&one;
+}
+
+void tbforth_image_header(struct tbforth_image *img) {
+  memset(img, 0, sizeof(*img));
+  img->magic = IMAGE_MAGIC;
+  img->version = DICT_VERSION;
+  img->cell_size = sizeof(CELL);
+  img->little_endian = image_little_endian();
+  img->here = dict->here;
+  img->last_word_idx = dict->last_word_idx;
+  img->varidx = dict->varidx;
+  img->max_cells = dict->max_cells;
+  img->size = IMAGE_DICT_BYTES(dict->here);
+  img->checksum = image_sum((uint8_t*)dict, img->size);
+}
+
+/* Is the header sane? With d (holding img->size bytes): is d the image? */
+bool tbforth_image_check(struct tbforth_image *img, struct dict *d) {
+  if ((img->magic != IMAGE_MAGIC && img->magic != SNAPSHOT_MAGIC) ||
+      img->version != DICT_VERSION ||
+      img->cell_size != sizeof(CELL) ||
+      img->little_endian != image_little_endian() ||
+      img->here > MAX_DICT_CELLS ||
+      img->size != IMAGE_DICT_BYTES(img->here))
+    return 0;
+  return d == NULL ||
+    (d->version == DICT_VERSION && d->here == img->here &&
+     d->last_word_idx == img->last_word_idx && d->varidx == img->varidx &&
+     image_sum((uint8_t*)d, img->size) == img->checksum);
+}
+
+/*
+  Snapshots. The host saves the header, dict (as in an image) and all of
+  tbforth_ram. To come back, it checks its copies, makes them the current
+  dict and tbforth_ram, and calls tbforth_snapshot_restore().
+*/
+void tbforth_snapshot_header(struct tbforth_snapshot *s) {
+  memset(s, 0, sizeof(*s));
+  tbforth_image_header(&s->img);
+  s->img.magic = SNAPSHOT_MAGIC;
+  s->ram_cells = TOTAL_RAM_CELLS;
+  s->ms = sched_now();
+  s->sched = *sched;
+  s->ram_checksum = image_sum((uint8_t*)tbforth_ram, SNAPSHOT_RAM_BYTES);
+}
+
+bool tbforth_snapshot_check(struct tbforth_snapshot *s, struct dict *d, RAMC *ram) {
+  return s->img.magic == SNAPSHOT_MAGIC && tbforth_image_check(&s->img, d) &&
+    s->ram_cells == TOTAL_RAM_CELLS && s->sched.uram[0] < TOTAL_RAM_CELLS &&
+    image_sum((uint8_t*)ram, SNAPSHOT_RAM_BYTES) == s->ram_checksum;
+}
+
+/*
+  Carry on from a snapshot: the interpreter (task 0) starts afresh, other
+  tasks pick up where they were. A task that took the snapshot itself is
+  gone (it was in the middle of save-snapshot), fds waited on are gone
+  (those tasks just wake up) and sleepers keep their time left.
+*/
+void tbforth_snapshot_restore(struct tbforth_snapshot *s) {
+  RAMC shift;
+  int t;
+
+  tbforth_dict = (CELL*)dict;
+  tbforth_iram = (struct tbforth_iram*)tbforth_ram;
+  tbforth_iram->state = 0;
+  tbforth_abort_clr();
+  DICT_INDEX_INVALIDATE();
+  A_REG = B_REG = 0;
+  *sched = s->sched;
+  sched_abort();
+  tbforth_uram = TASK_URAM(0);
+  tbforth_uram->ridx = tbforth_uram->rsize + tbforth_uram->dsize;
+  tbforth_uram->didx = -1;
+
+  for (t = 0; t < MAX_TASKS; t++)
+    if (sched->state[t] == TASK_WAITING) sched_ready(t);
+  sched->nwait = 0;
+  sched->ticks = 0;
+  shift = sched_now() - s->ms;
+  for (t = 0; t < sched->nsleep; t++)
+    sched->wake[sched->sleeping[t]] += shift;
+}
+
+/*
+  Instances. The host provides the dictionary and TOTAL_RAM_CELLS of RAM,
+  then selects the instance and calls tbforth_init() (or loads an image
+  and RAM it saved earlier).
+*/
+void tbforth_vm_setup(struct tbforth_vm *vm, struct dict *d, RAMC *ram) {
+  memset(vm, 0, sizeof(*vm));
+  vm->dict = d;
+  vm->ram = ram;
+  vm->uram = (struct tbforth_uram*)((char*)ram + sizeof(struct tbforth_iram));
+}
+
+struct tbforth_vm* tbforth_vm_select(struct tbforth_vm *vm) {
+  struct tbforth_vm *old = tbforth_cur_vm;
+
+  if (vm == old) return old;
+  old->dict = dict;
+  old->ram = tbforth_ram;
+  old->uram = tbforth_uram;
+  old->abort_request = _tbforth_abort_request;
+  old->a_reg = A_REG;
+  old->b_reg = B_REG;
+
+  tbforth_cur_vm = vm;
+  dict = vm->dict;
+  tbforth_dict = (CELL*)dict;
+  tbforth_ram = vm->ram;
+  tbforth_iram = (struct tbforth_iram*) tbforth_ram;
+  tbforth_uram = vm->uram;
+  _tbforth_abort_request = vm->abort_request;
+  A_REG = vm->a_reg;
+  B_REG = vm->b_reg;
+  sched = &vm->sched;
+  natives = &vm->natives;
+#ifdef DICT_HASH_SLOTS
+  dict_index = &vm->index;
+#endif
+  return old;
+}
+
+tbforth_stat tbforth_vm_interpret(struct tbforth_vm *vm, char *str) {
+  struct tbforth_vm *old = tbforth_vm_select(vm);
+  tbforth_stat stat = tbforth_interpret(str);
+  tbforth_vm_select(old);
+  return stat;
+}
+
+tbforth_stat tbforth_vm_exec(struct tbforth_vm *vm, CELL ip) {
+  struct tbforth_vm *old = tbforth_vm_select(vm);
+  tbforth_stat stat = exec(ip, 0, tbforth_uram->ridx-1);
+  tbforth_vm_select(old);
+  return stat;
+}
+
 
 // Opcodes
 // LIT must be 1!
@@ -300,63 +973,558 @@ enum {
   VAR_ALLOT, CALLC,   FIND, CHAR_APPEND, CHAR_STORE, CHAR_FETCH, 
   BYTE_COPY, BYTE_CMP,
   _CREATE, PARSE_NUM,
-  INTERP, NUM_TO_STR, UNUM_TO_STR,
+  INTERP,
+  SPAWN, YIELD, SUSPEND, RESUME, TASK_END, TASK_ID, SLEEP_MS, AT_MS,
+  WAIT_FD, PROFILE, OPSTATS, INLINE,
+  // Small literals (see compile_num()).
+  ZERO, ONE, TWO, MINUS_ONE,
+  // Superinstructions (see fuse_def()). Never stored as words.
+  RLOOP, LOOP1, PLOOP, ZBRANCH, BRANCH,
+  LIT_ADD, LIT_SUB, LIT_AND, LIT_EQ, LIT_RPICK, DLIT_ADD, DLIT_SUB,
+  DUP_EQ_ZERO, OVER_ADD, FETCH_ADD, RDROP, ONE_ADD, ONE_SUB,
+  NUM_TO_STR, UNUM_TO_STR,
+  // Replaces the first cell of a word translated to C (see native_call()).
+  NATIVE,
   LAST_PRIMITIVE
 };
 
-void store_prim(char* str, CELL val) {
-  make_word(str,strlen(str));
-  DICT_APPEND(val);
-  //  DICT_APPEND(EXIT); // not needed since we optimize primitives by inlining them
-  DICT_WRITE((dict->last_word_idx+1), tbforth_dict[dict->last_word_idx+1]|PRIM_BIT);
+#ifdef TBFORTH_OPSTATS
+/*
+  Opcode statistics: how often exec() runs each opcode, and each opcode
+  right after another. All calls of colon definitions count as one
+  opcode (NOPS-1).
+*/
+#define NOPS (LAST_PRIMITIVE+2)
+static TBFORTH_TLS uint64_t op_count[NOPS];
+static TBFORTH_TLS uint64_t op_pair[NOPS][NOPS];
+static TBFORTH_TLS uint8_t op_prev;
+
+# define OPSTAT(c) do {							\
+    uint8_t o_ = (c) > LAST_PRIMITIVE ? NOPS-1 : (c);			\
+    op_count[o_]++;							\
+    op_pair[op_prev][o_]++;						\
+    op_prev = o_;							\
+  } while(0)
+
+struct op_stat { uint8_t a, b; uint64_t n; };
+
+static int op_stat_cmp(const void *x, const void *y) {
+  const struct op_stat *p = x, *q = y;
+  return p->n < q->n ? 1 : p->n > q->n ? -1 : 0;
 }
 
-/* Bootstrap code */
-void tbforth_bootstrap(void) {
-  tbforth_init();
-  tbforth_load_prims();
-  tbforth_interpret("(create) : 1 iram ! (create) 1 iram ! here 2 iram + !  ;");
-  OS_WORDS();
-  MCU_WORDS();
+/* Calls show as opcode -1 */
+#define OP_OUT(o) dpush((o) == NOPS-1 ? (RAMC)-1 : (o))
+
+/*
+  (opstats) ( n 0 - op count t | f ) the nth busiest opcode
+            ( n 1 - op1 op2 count t | f ) the nth busiest pair
+            ( n -1 - f ) resets
+  n = 0 takes a sorted copy (so the report doesn't count itself).
+*/
+static void opstats_op(void) {
+  static TBFORTH_TLS struct op_stat sorted[NOPS*NOPS];
+  static TBFORTH_TLS uint32_t nsorted;
+  int32_t kind = dpop(), n = dpop();
+  int a, b;
+
+  if (kind < 0) {
+    memset(op_count, 0, sizeof(op_count));
+    memset(op_pair, 0, sizeof(op_pair));
+    nsorted = 0;
+    dpush(0);
+    return;
+  }
+  if (n == 0) {
+    nsorted = 0;
+    for (a = 0; a < NOPS; a++) {
+      if (kind == 0) {
+	if (op_count[a]) sorted[nsorted++] = (struct op_stat){a, 0, op_count[a]};
+	continue;
+      }
+      for (b = 0; b < NOPS; b++)
+	if (op_pair[a][b]) sorted[nsorted++] = (struct op_stat){a, b, op_pair[a][b]};
+    }
+    qsort(sorted, nsorted, sizeof(sorted[0]), op_stat_cmp);
+  }
+  if (n < 0 || (uint32_t)n >= nsorted) {
+    dpush(0);
+    return;
+  }
+  OP_OUT(sorted[n].a);
+  if (kind == 1) OP_OUT(sorted[n].b);
+  dpush(sorted[n].n);
+  dpush(-1);
 }
+#else
+# define OPSTAT(c) do {} while(0)
+static void opstats_op(void) {
+  (void)dpop();
+  (void)dpop();
+  dpush(0);
+}
+#endif
 
-void tbforth_load_prims(void) {
-  dict->here = DICT_HEADER_WORDS+1;
-  /*
-    Store our primitives into the dictionary as "callable" words (for interpret).
-    (During compilation references to these word definitions are optimized away).
-  */
+#ifdef FUSE_SUPERINSTRUCTIONS
+/*
+  Superinstructions: common sequences the compiler lays down (mostly by
+  for/next, do/loop and if) are fused into one opcode.
 
-  // Primary opcodes
-  //
-  store_prim("lit", LIT);
-  store_prim("dlit", DLIT);
-  store_prim("drop", DROP);
-  store_prim("rot", ROT);
-  store_prim("dup", DUP);
-  store_prim("swap", SWAP);
-  store_prim("over", OVER);
-  store_prim("jmp", JMP);
-  store_prim("0jmp?", JMP_IF_ZERO);
-  store_prim("0skip?", SKIP_IF_ZERO);
-  store_prim(",", COMMA);
-  store_prim("d,", DCOMMA);
-  store_prim("1+", INCR);
-  store_prim("1-", DECR);
-  store_prim("+", ADD);
-  store_prim("-", SUB);
-  store_prim("and", AND);
-  store_prim("or", OR);
-  store_prim("xor", XOR);
-  store_prim("invert", INVERT);
-  store_prim("lshift", LSHIFT);
-  store_prim("rshift", RSHIFT);
-  store_prim("*", MULT);
-  store_prim("/", DIV);
-  store_prim("*/", MULT_DIV);
-  store_prim("mod", MOD);
-  store_prim("0=", EQ_ZERO);
-  store_prim("0>", GT_ZERO);
+  The fused opcode just replaces the *first* cell of the sequence. The
+  rest of the sequence stays where it is and the fused opcode skips over
+  it (or branches). This keeps every address in the definition (and thus
+  every branch target) the same. We still refuse to fuse a sequence if
+  something branches into the middle of it.
+
+  ANY matches any operand cell. Longest sequences go first.
+*/
+#define ANY 0xFFFF
+#define FUSE_MAX 13
+static const struct fusion {
+  CELL op;			/* fused opcode */
+  uint8_t len;			/* cells in sequence */
+  CELL seq[FUSE_MAX];
+} fusions[] = {
+  /* loop:  1 r> + dup >r 1 rpick >= lit <do> 0jmp? */
+  { LOOP1, 13, { LIT, 1, RPOP, ADD, DUP, RPUSH, LIT, 1, RPICK,
+		 GREATER_THAN_EQ, LIT, ANY, JMP_IF_ZERO } },
+  /* +loop: r> + dup >r 1 rpick >= lit <do> 0jmp? */
+  { PLOOP, 11, { RPOP, ADD, DUP, RPUSH, LIT, 1, RPICK,
+		 GREATER_THAN_EQ, LIT, ANY, JMP_IF_ZERO } },
+  /* next: r> 1- dup >r 0< lit <for> 0jmp? */
+  { RLOOP, 8, { RPOP, DECR, DUP, RPUSH, LT_ZERO, LIT, ANY, JMP_IF_ZERO } },
+  { DLIT_ADD, 4, { DLIT, ANY, ANY, ADD } },
+  { DLIT_SUB, 4, { DLIT, ANY, ANY, SUB } },
+  { ZBRANCH, 3, { LIT, ANY, JMP_IF_ZERO } }, /* if, while, until */
+  { BRANCH, 3, { LIT, ANY, JMP } },	     /* else, again, repeat */
+  { LIT_ADD, 3, { LIT, ANY, ADD } },
+  { LIT_SUB, 3, { LIT, ANY, SUB } },
+  { LIT_AND, 3, { LIT, ANY, AND } },
+  { LIT_EQ, 3, { LIT, ANY, EQ } },
+  { LIT_RPICK, 3, { LIT, ANY, RPICK } },	     /* i, j */
+  { DUP_EQ_ZERO, 2, { DUP, EQ_ZERO } },
+  { OVER_ADD, 2, { OVER, ADD } },
+  { FETCH_ADD, 2, { FETCH, ADD } },
+  { RDROP, 2, { RPOP, DROP } },
+  { ONE_ADD, 2, { ONE, ADD } },
+  { ONE_SUB, 2, { ONE, SUB } },
+};
+#define FUSIONS (sizeof(fusions)/sizeof(fusions[0]))
+#endif
+
+/* Cells taken by opcode op (including inline operands) */
+static CELL op_len(CELL op) {
+#ifdef FUSE_SUPERINSTRUCTIONS
+  uint8_t i;
+#endif
+  if (op == LIT) return 2;
+  if (op == DLIT) return 3;
+#ifdef FUSE_SUPERINSTRUCTIONS
+  for (i = 0; i < FUSIONS; i++)
+    if (fusions[i].op == op) return fusions[i].len;
+#endif
+  return 1;
+}
+
+#ifdef FUSE_SUPERINSTRUCTIONS
+/* Cells taken by the instruction at a */
+static CELL op_cells(CELL a) {
+  return op_len(tbforth_dict[a]);
+}
+
+/* Literal (jump target, skip count) laid down at a? */
+static bool literal_at(CELL a, RAMC *val) {
+  if (tbforth_dict[a] == LIT) {
+    *val = tbforth_dict[a+1];
+    return 1;
+  }
+  if (tbforth_dict[a] == DLIT) {
+    *val = ((RAMC)tbforth_dict[a+1] << 16) | tbforth_dict[a+2];
+    return 1;
+  }
+  switch (tbforth_dict[a]) {
+  case ZERO: *val = 0; return 1;
+  case ONE: *val = 1; return 1;
+  case TWO: *val = 2; return 1;
+  case MINUS_ONE: *val = -1; return 1;
+  }
+  return 0;
+}
+
+/*
+  Walk the instructions of a definition, skipping the data of ," strings
+  (lit <count addr> lit <end> jmp <count> <chars...>).
+*/
+#define FOR_EACH_OP(a, start, end)					\
+  for (a = start; a < end;						\
+       a = (tbforth_dict[a] == LIT && tbforth_dict[a+1] == a+5 &&	\
+	    tbforth_dict[a+2] == LIT && tbforth_dict[a+4] == JMP &&	\
+	    tbforth_dict[a+3] > a) ? tbforth_dict[a+3] : a + op_cells(a))
+
+static bool fuse_match(CELL a, CELL end, const struct fusion *f) {
+  uint8_t i;
+  if (a + f->len > end) return 0;
+  for (i = 0; i < f->len; i++) {
+    if (f->seq[i] != ANY && f->seq[i] != tbforth_dict[a+i]) return 0;
+  }
+  return 1;
+}
+
+/* Does anything in [start,end) branch into (a, a+len)? */
+static bool fuse_is_target(CELL start, CELL end, CELL a, CELL len) {
+  CELL b, n, t;
+  RAMC val;
+  FOR_EACH_OP(b, start, end) {
+    if (!literal_at(b, &val)) continue;
+    n = b + op_cells(b);
+    switch (tbforth_dict[n]) {
+    case JMP: case JMP_IF_ZERO: case EXEC:
+      t = val; break;
+    case SKIP_IF_ZERO:
+      t = n + 1 + val; break;
+    default:
+      continue;
+    }
+    if (t > a && t < a + len) return 1;
+  }
+  return 0;
+}
+
+void fuse_def(CELL start, CELL end) {
+  CELL a;
+  uint8_t i;
+  FOR_EACH_OP(a, start, end) {
+    for (i = 0; i < FUSIONS; i++) {
+      if (fuse_match(a, end, &fusions[i]) &&
+	  !fuse_is_target(start, end, a, fusions[i].len)) {
+	DICT_WRITE(a, fusions[i].op);
+	break;
+      }
+    }
+  }
+}
+#endif
+
+/*
+  Inlining: a call of a word with INLINE_BIT set ("inline", or any short
+  enough word with INLINE_MAX_CELLS) compiles to a copy of its body
+  instead, so is and to on it no longer reach its callers. That only
+  works for straight line code that doesn't care where it runs from: no
+  branches (their targets are absolute), no early exit and nothing that
+  reaches past its own return address on the return stack (r> with
+  nothing pushed, r@ there, rpick, i). Nor calls: the callee could do
+  that for it (exit-if0-). Inline words it calls are copies by then, so
+  2dup in /mod is fine.
+
+  Where the body of the definition at xt ends (its one EXIT), or 0 if it
+  can't be inlined. The first cell may be NATIVE (see native_call()).
+*/
+static CELL inline_end(CELL xt) {
+  CELL a, op;
+  int depth = 0;
+
+  for (a = xt; a < dict_here(); a += op_len(op)) {
+    op = tbforth_dict[a];
+    if (op == NATIVE) op = tbforth_native_first(a);
+    switch (op) {
+    case EXIT:
+      return depth == 0 ? a : 0;
+    case RPUSH:
+      depth++;
+      break;
+    case RPOP: case RDROP:
+      if (depth-- == 0) return 0;
+      break;
+    case RTOP:
+      if (depth == 0) return 0;
+      break;
+    case JMP: case JMP_IF_ZERO: case SKIP_IF_ZERO: case RPICK:
+    case RLOOP: case LOOP1: case PLOOP: case ZBRANCH: case BRANCH:
+    case LIT_RPICK: case EXEC:
+      return 0;
+    }
+    if (op > LAST_PRIMITIVE) return 0;
+  }
+  return 0;
+}
+
+/*
+  Set INLINE_BIT on the last word (which must be the last thing in the
+  dictionary) if its body can be inlined and is at most max cells.
+*/
+static bool make_inline(CELL max) {
+  CELL h = dict->last_word_idx;
+  CELL xt = h + 2 + HEAD_LEN(h) / BYTES_PER_CELL + HEAD_LEN(h) % BYTES_PER_CELL;
+  CELL end;
+
+  if (dict_here() - xt > max + 1) return 0;
+  end = inline_end(xt);
+  if (end == 0 || end + 1 != dict_here() ||
+      (tbforth_dict[h+1] & (IMMEDIATE_BIT|PRIM_BIT)))
+    return 0;
+  DICT_WRITE(h+1, tbforth_dict[h+1] | INLINE_BIT);
+  return 1;
+}
+
+/* Compile a copy of the body of (inline) xt */
+static void compile_inline(CELL xt) {
+  CELL a, end = inline_end(xt);
+
+  for (a = xt; a < end; a++)
+    DICT_APPEND(a == xt && tbforth_dict[a] == NATIVE ?
+		tbforth_native_first(a) : tbforth_dict[a]);
+}
+
+/*
+  Native code (see struct tbforth_native). Each instance installs its
+  own (struct tbforth_natives): NATIVE is in its dictionary only.
+  native_depth counts native words on the C stack: they can't be parked
+  by a task switch, so exec() refuses to switch under them.
+*/
+static TBFORTH_TLS uint8_t native_depth;
+
+#ifdef TBFORTH_JIT
+# if defined(TBFORTH_THREADS) || !defined(__x86_64__)
+#  error "TBFORTH_JIT is for single threaded x86-64 hosts"
+# endif
+/*
+  Words compiled by the JIT (see jit_compile()) are in natives->jit,
+  searched before natives->tab. Calls are counted by xt. natives->entry[]
+  is where compiled code calls compiled code. The compiler itself (and
+  the aot_build() analysis it runs on) is shared by all instances, hence
+  no threads.
+*/
+static uint16_t jit_threshold = JIT_THRESHOLD;
+static struct dict *jit_built_dict;	/* dictionary aot_build() saw */
+static CELL jit_built_here, jit_built_last;
+static void jit_compile(CELL xt);
+# define JIT_CALL(xt) do {						\
+    if (++natives->calls[xt] == jit_threshold) jit_compile(xt);		\
+  } while(0)
+#else
+# define JIT_CALL(xt) do {} while(0)
+#endif
+
+/* FNV-1a over the cells [a,end) */
+static uint32_t native_sum(CELL a, CELL end) {
+  uint32_t h = 2166136261u;
+  for (; a < end; a++)
+    h = (h ^ tbforth_dict[a]) * 16777619u;
+  return h;
+}
+
+static const struct tbforth_native *native_search(const struct tbforth_native *tab,
+						  int n, CELL a) {
+  int lo = 0, hi = n - 1, m;
+  while (lo <= hi) {
+    m = (lo + hi) / 2;
+    if (a < tab[m].xt) hi = m - 1;
+    else if (a >= tab[m].end) lo = m + 1;
+    else return &tab[m];
+  }
+  return 0;
+}
+
+/* The installed word holding a (0 if none) */
+static const struct tbforth_native *native_find(CELL a) {
+#ifdef TBFORTH_JIT
+  const struct tbforth_native *e = native_search(natives->jit, natives->njit, a);
+  if (e) return e;
+#endif
+  return native_search(natives->tab, natives->n, a);
+}
+
+void tbforth_native_remove(void) {
+  uint16_t i;
+  for (i = 0; i < natives->n; i++)
+    if (tbforth_dict[natives->tab[i].xt] == NATIVE)
+      DICT_WRITE(natives->tab[i].xt, natives->tab[i].first);
+  natives->n = 0;
+#ifdef TBFORTH_JIT
+  for (i = 0; i < natives->njit; i++) {
+    if (tbforth_dict[natives->jit[i].xt] == NATIVE)
+      DICT_WRITE(natives->jit[i].xt, natives->jit[i].first);
+    natives->entry[natives->jit[i].xt] = 0;
+  }
+  natives->njit = 0;
+  jit_built_here = 0;
+#endif
+  natives->lo = natives->hi = 0;
+  memset(natives->cache, 0, sizeof(natives->cache));
+}
+
+/*
+  Install the words of tab that are still what tbforth-aot saw. Returns
+  how many.
+*/
+uint16_t tbforth_native_install(const struct tbforth_native *tab, uint16_t n) {
+  uint16_t i, installed = 0;
+  const struct tbforth_native *e;
+
+  tbforth_native_remove();
+  natives->tab = tab;
+  natives->n = n;
+  natives->lo = 0xFFFF;
+  for (i = 0; i < n; i++) {
+    e = &tab[i];
+    if (e->end > dict_here() || e->first != tbforth_dict[e->xt] ||
+	e->sum != native_sum(e->xt + 1, e->end))
+      continue;
+    DICT_WRITE(e->xt, NATIVE);
+    if (e->xt < natives->lo) natives->lo = e->xt;
+    if (e->end > natives->hi) natives->hi = e->end;
+    installed++;
+  }
+  if (installed == 0) natives->n = natives->lo = 0;
+  return installed;
+}
+
+/* Put the words in [lo,hi) back to being interpreted */
+static void native_forget(CELL lo, CELL hi) {
+  const struct tbforth_native *e;
+  for (; lo < hi; lo++) {
+    if ((e = native_find(lo)) == 0) continue;
+    if (tbforth_dict[e->xt] == NATIVE)
+      DICT_WRITE(e->xt, e->first);
+#ifdef TBFORTH_JIT
+    if (e >= natives->jit && e < natives->jit + natives->njit) { /* its code is gone for good */
+      natives->entry[e->xt] = 0;
+      memmove((void*)e, e + 1, (natives->jit + --natives->njit - e) * sizeof(*e));
+      memset(natives->cache, 0, sizeof(natives->cache));
+    }
+#endif
+  }
+}
+
+/* The dictionary cells [lo,hi) are about to be written */
+static void native_written(RAMC lo, RAMC hi) {
+  if (lo < natives->lo) lo = natives->lo;
+  if (hi > natives->hi) hi = natives->hi;
+  if (lo < hi) native_forget(lo, hi);
+}
+
+/* So are the n bytes at p, if they are in the dictionary (c!, bcopy...) */
+static void native_written_bytes(const char *p, RAMC n) {
+  uintptr_t d = (uintptr_t)tbforth_dict, b = (uintptr_t)p;
+  if (n == 0 || b + n <= d || b >= d + natives->hi * sizeof(CELL)) return;
+  if (b < d) b = d;
+  native_written((b - d) / sizeof(CELL),
+		 ((uintptr_t)p + n - d + sizeof(CELL) - 1) / sizeof(CELL));
+}
+
+/*
+  v is about to be ! into the dictionary at a. Rewinding here (forget)
+  forgets everything above it.
+*/
+static void native_store(CELL a, CELL v) {
+  native_written(a, a + 1);
+  if (&tbforth_dict[a] == &dict->here && v < natives->hi)
+    native_forget(v, natives->hi);
+}
+
+/* @ of a cell in the dictionary that reads NATIVE: what was there */
+CELL tbforth_native_first(CELL a) {
+  const struct tbforth_native *e = native_find(a);
+  return e && e->xt == a ? e->first : NATIVE;
+}
+
+static tbforth_stat native_call(CELL xt) {
+  const struct tbforth_native **c = &natives->cache[xt & (NATIVE_CACHE-1)];
+  tbforth_stat stat;
+
+  if (*c == 0 || (*c)->xt != xt) {
+    *c = native_find(xt);
+    if (*c == 0 || (*c)->xt != xt) {
+      *c = 0;
+      tbforth_abort_request(ABORT_ILLEGAL);
+      tbforth_abort(xt);
+      return E_ABORT;
+    }
+  }
+  native_depth++;
+  stat = (*c)->fn();
+  native_depth--;
+  return stat;
+}
+
+/* Calls from native code into the interpreter */
+tbforth_stat tbforth_native_exec(CELL xt) {
+  return exec(xt, 0, tbforth_uram->ridx-1);
+}
+
+tbforth_stat tbforth_native_prim(CELL xt) {
+  return exec(xt, 1, tbforth_uram->ridx-1);
+}
+
+/*
+  A word called from native code came back without its return address
+  (rcall-1) on top of the return stack. If it dropped it (r> drop) at the
+  top of the caller (rentry), the caller is done. If it changed it, the
+  caller carries on interpreted from there.
+*/
+tbforth_stat tbforth_native_return(RAMC rentry, RAMC rcall) {
+  if (tbforth_uram->ridx == rcall && rcall == rentry)
+    return U_OK;
+  if (tbforth_uram->ridx == rcall - 1)
+    return exec(rpop(), 0, rentry-1);
+  tbforth_abort_request(ABORT_ILLEGAL);
+  tbforth_abort(0);
+  return E_ABORT;
+}
+
+void store_prim(char* str, CELL val) {
+  make_word(str,strlen(str));
+  DICT_APPEND(val);
+  //  DICT_APPEND(EXIT); // not needed since we optimize primitives by inlining them
+  DICT_WRITE((dict->last_word_idx+1), tbforth_dict[dict->last_word_idx+1]|PRIM_BIT);
+}
+
+/* Bootstrap code */
+void tbforth_bootstrap(void) {
+  tbforth_init();
+  tbforth_load_prims();
+  tbforth_interpret("(create) : 1 iram ! (create) 1 iram ! here 2 iram + !  ;");
+  OS_WORDS();
+  MCU_WORDS();
+}
+
+void tbforth_load_prims(void) {
+  dict->here = DICT_HEADER_WORDS+1;
+  /*
+    Store our primitives into the dictionary as "callable" words (for interpret).
+    (During compilation references to these word definitions are optimized away).
+  */
+
+  // Primary opcodes
+  //
+  store_prim("lit", LIT);
+  store_prim("dlit", DLIT);
+  store_prim("drop", DROP);
+  store_prim("rot", ROT);
+  store_prim("dup", DUP);
+  store_prim("swap", SWAP);
+  store_prim("over", OVER);
+  store_prim("jmp", JMP);
+  store_prim("0jmp?", JMP_IF_ZERO);
+  store_prim("0skip?", SKIP_IF_ZERO);
+  store_prim(",", COMMA);
+  store_prim("d,", DCOMMA);
+  store_prim("1+", INCR);
+  store_prim("1-", DECR);
+  store_prim("+", ADD);
+  store_prim("-", SUB);
+  store_prim("and", AND);
+  store_prim("or", OR);
+  store_prim("xor", XOR);
+  store_prim("invert", INVERT);
+  store_prim("lshift", LSHIFT);
+  store_prim("rshift", RSHIFT);
+  store_prim("*", MULT);
+  store_prim("/", DIV);
+  store_prim("*/", MULT_DIV);
+  store_prim("mod", MOD);
+  store_prim("0=", EQ_ZERO);
+  store_prim("0>", GT_ZERO);
   store_prim("0<", LT_ZERO);
   store_prim("=", EQ);
   store_prim("<", LESS_THAN);
@@ -384,6 +1552,7 @@ void tbforth_load_prims(void) {
   store_prim("next-char", CNEXT);
   store_prim(";", EXIT);
   store_prim("immediate", IMMEDIATE);
+  store_prim("inline", INLINE);
 
   // extended opcodes
   //
@@ -403,6 +1572,17 @@ void tbforth_load_prims(void) {
   store_prim("interpret", INTERP);
   store_prim("cf", CALLC);
   store_prim("here", HERE);
+  store_prim("spawn", SPAWN);
+  store_prim("yield", YIELD);
+  store_prim("suspend", SUSPEND);
+  store_prim("resume", RESUME);
+  store_prim("(task-end)", TASK_END);
+  store_prim("task-id", TASK_ID);
+  store_prim("sleep-ms", SLEEP_MS);
+  store_prim("at-ms", AT_MS);
+  store_prim("(wait-fd)", WAIT_FD);
+  store_prim("(profile)", PROFILE);
+  store_prim("(opstats)", OPSTATS);
 
   // Allocate the scratch pad
   //
@@ -424,247 +1604,445 @@ void tbforth_abort(CELL wid) {
   }
   tbforth_iram->state = 0;
   tbforth_abort_clr();
+  sched_abort();
+  PROFILE_RESET(0);
   tbforth_uram->ridx = tbforth_uram->rsize + tbforth_uram->dsize;
   tbforth_uram->didx = -1;
 }
 
-// Fix me... this is not in uram.. probably should be.
-//
-static char* A_REG;			/* (char) address register */
-static char* B_REG;			/* (char) address register */
+/*
+  The inner interpreter.
+
+  Each opcode body is written once, between OP() and DISPATCH(). With
+  THREADED_DISPATCH (GCC/Clang "labels as values") every body jumps
+  straight to the next opcode's label through optab[]. Otherwise the
+  bodies are cases in one big switch inside a loop (portable C99).
+
+  The switch checks for aborts and toplevelprim after every opcode. The
+  threaded engine only checks after opcodes that can request an abort
+  (DISPATCH_CHECKED), and handles toplevelprim by dispatching everything
+  after the first opcode through oncetab[] (which just returns).
+*/
+#ifdef THREADED_DISPATCH
+# define OP(op) L_##op:
+# define DISPATCH() do {						\
+    cmd = code[ip++];							\
+    if (dtab == optab) OPSTAT(cmd);					\
+    goto *dtab[cmd > LAST_PRIMITIVE ? LAST_PRIMITIVE+1 : cmd];		\
+  } while(0)
+# define DISPATCH_CHECKED() do {					\
+    if (tbforth_aborting()) goto L_ABORTING;				\
+    DISPATCH();								\
+  } while(0)
+# define CHECK_IP() do { if (ip == 0) goto L_BADIP; } while(0)
+#else
+# define OP(op) case op:
+# define DISPATCH() break
+# define DISPATCH_CHECKED() break
+# define CHECK_IP()
+#endif
+
+/*
+  With TOS_CACHE the stack macros work on exec()'s locals: tos is the top
+  of the data stack (its slot, *sp, is stale) and rp is the top of the
+  return stack. SPILL() writes them back to tbforth_uram before anything
+  else can look at the stacks and FILL() reloads them (uram may have been
+  switched meanwhile).
+  An empty stack caches ds[-1] (rsize) in tos, so pushing writes it back
+  unchanged.
+*/
+#ifdef TOS_CACHE
+# pragma push_macro("dpush")
+# pragma push_macro("dpop")
+# pragma push_macro("dpick")
+# pragma push_macro("rpush")
+# pragma push_macro("rpop")
+# pragma push_macro("rpick")
+# pragma push_macro("dtop")
+# pragma push_macro("dtop2")
+# pragma push_macro("dtop3")
+# undef dpush
+# undef dpop
+# undef dpick
+# undef rpush
+# undef rpop
+# undef rpick
+# undef dtop
+# undef dtop2
+# undef dtop3
+# define dpush(n) (dtmp = (n), *sp++ = tos, tos = dtmp)
+# define dpop() (dtmp = tos, tos = *--sp, dtmp)
+# define dpick(n) ((n) ? sp[-(n)] : tos)
+# define rpush(n) (*--rp = (n))
+# define rpop() (*rp++)
+# define rpick(n) rp[n]
+# define dtop() tos
+# define dtop2() sp[-1]
+# define dtop3() sp[-2]
+# define SPILL() do {							\
+    *sp = tos;								\
+    tbforth_uram->didx = sp - ds;					\
+    tbforth_uram->ridx = rp - ds;					\
+  } while(0)
+# define FILL() do {							\
+    ds = tbforth_uram->ds;						\
+    sp = ds + (int32_t)tbforth_uram->didx;				\
+    rp = ds + tbforth_uram->ridx;					\
+    tos = *sp;								\
+    ulo = (RAMC*)tbforth_uram - tbforth_ram;				\
+    ulen = (RAMC*)(ds + tbforth_uram->dsize + tbforth_uram->rsize) -	\
+      (RAMC*)tbforth_uram;						\
+  } while(0)
+# define RIDX() ((RAMC)(rp - ds))
+/* Is RAM cell a part of the current uram's header or stacks? */
+# define IN_STACKS(a) ((RAMC)((a) - ulo) < ulen)
+#else
+# define SPILL()
+# define FILL()
+# define RIDX() tbforth_uram->ridx
+# define IN_STACKS(a) 0
+#endif
 
 tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
   // Scratch/Register variables. Most are emphemeral. They do not
   // "exist" outside the currently executing words so giving Forth
   // access to them has no advantage.
-  // We make them static so that they don't take up C stack space...
   //
-  
-  static RAMC r1, r2;
-  static char *str1, *str2;
-  static char char1;
-  static CELL cmd;
+  RAMC r1, r2;
+  char *str1, *str2;
+  char char1;
+  CELL cmd;
+  CELL *code = tbforth_dict;	/* the dictionary doesn't move under us */
+  /* tasks may switch uram (only looked at on the way out, keep it off
+     the registers) */
+  struct tbforth_uram * volatile uram0 = tbforth_uram;
+#ifdef TOS_CACHE
+  RAMC tos, dtmp;
+  RAMC *ds, *sp, *rp;
+  RAMC ulo, ulen;		/* current uram (as RAM cells) */
+#endif
+
+  FILL();
+  if (!toplevelprim) {
+    JIT_CALL(ip);
+    PROFILE_CALL(ip);
+  }
 
+#ifdef THREADED_DISPATCH
+  static void *optab[LAST_PRIMITIVE+2] = {
+    [0] = &&L_ILLEGAL,
+    [LIT] = &&L_LIT, [COLD] = &&L_COLD, [DLIT] = &&L_DLIT,
+    [ABORT] = &&L_ABORT, [DEF] = &&L_DEF, [IMMEDIATE] = &&L_IMMEDIATE,
+    [URAM_BASE_ADDR] = &&L_URAM_BASE_ADDR,
+    [STORE_URAM_BASE_ADDR] = &&L_STORE_URAM_BASE_ADDR,
+    [RTOP] = &&L_RTOP, [RPICK] = &&L_RPICK, [HERE] = &&L_HERE,
+    [RAM_BASE_ADDR] = &&L_RAM_BASE_ADDR, [INCR] = &&L_INCR, [DECR] = &&L_DECR,
+    [ADD] = &&L_ADD, [SUB] = &&L_SUB, [MULT] = &&L_MULT, [DIV] = &&L_DIV,
+    [MULT_DIV] = &&L_MULT_DIV, [MOD] = &&L_MOD, [AND] = &&L_AND,
+    [JMP] = &&L_JMP, [JMP_IF_ZERO] = &&L_JMP_IF_ZERO,
+    [SKIP_IF_ZERO] = &&L_SKIP_IF_ZERO, [EXIT] = &&L_EXIT,
+    [OR] = &&L_OR, [XOR] = &&L_XOR, [LSHIFT] = &&L_LSHIFT, [RSHIFT] = &&L_RSHIFT,
+    [EQ_ZERO] = &&L_EQ_ZERO, [GT_ZERO] = &&L_GT_ZERO, [LT_ZERO] = &&L_LT_ZERO,
+    [EQ] = &&L_EQ, [DROP] = &&L_DROP, [DUP] = &&L_DUP, [SWAP] = &&L_SWAP,
+    [OVER] = &&L_OVER, [ROT] = &&L_ROT, [NEXT] = &&L_NEXT, [CNEXT] = &&L_CNEXT,
+    [EXEC] = &&L_EXEC, [LESS_THAN] = &&L_LESS_THAN,
+    [GREATER_THAN] = &&L_GREATER_THAN, [GREATER_THAN_EQ] = &&L_GREATER_THAN_EQ,
+    [INVERT] = &&L_INVERT, [COMMA] = &&L_COMMA, [DCOMMA] = &&L_DCOMMA,
+    [RPUSH] = &&L_RPUSH, [RPOP] = &&L_RPOP, [FETCH] = &&L_FETCH,
+    [STORE] = &&L_STORE, [COMMA_STRING] = &&L_COMMA_STRING,
+    [CHAR_A_ADDR_STORE] = &&L_CHAR_A_ADDR_STORE,
+    [CHAR_A_B_SWAP] = &&L_CHAR_A_B_SWAP, [CHAR_A_FETCH] = &&L_CHAR_A_FETCH,
+    [CHAR_A_STORE] = &&L_CHAR_A_STORE, [CHAR_A_INCR] = &&L_CHAR_A_INCR,
+    [CHAR_A_FETCH_INCR] = &&L_CHAR_A_FETCH_INCR,
+    [CHAR_A_STORE_INCR] = &&L_CHAR_A_STORE_INCR,
+    [VAR_ALLOT] = &&L_VAR_ALLOT, [CALLC] = &&L_CALLC, [FIND] = &&L_FIND,
+    [CHAR_APPEND] = &&L_CHAR_APPEND, [CHAR_STORE] = &&L_CHAR_STORE,
+    [CHAR_FETCH] = &&L_CHAR_FETCH, [BYTE_COPY] = &&L_BYTE_COPY,
+    [BYTE_CMP] = &&L_BYTE_CMP, [_CREATE] = &&L__CREATE,
+    [PARSE_NUM] = &&L_PARSE_NUM, [INTERP] = &&L_INTERP,
+    [SPAWN] = &&L_SPAWN, [YIELD] = &&L_YIELD, [SUSPEND] = &&L_SUSPEND,
+    [RESUME] = &&L_RESUME, [TASK_END] = &&L_TASK_END, [TASK_ID] = &&L_TASK_ID,
+    [SLEEP_MS] = &&L_SLEEP_MS, [AT_MS] = &&L_AT_MS,
+    [WAIT_FD] = &&L_WAIT_FD, [PROFILE] = &&L_PROFILE, [OPSTATS] = &&L_OPSTATS,
+    [INLINE] = &&L_INLINE,
+    [ZERO] = &&L_ZERO, [ONE] = &&L_ONE, [TWO] = &&L_TWO,
+    [MINUS_ONE] = &&L_MINUS_ONE,
+    [RLOOP] = &&L_RLOOP, [LOOP1] = &&L_LOOP1, [PLOOP] = &&L_PLOOP,
+    [ZBRANCH] = &&L_ZBRANCH, [BRANCH] = &&L_BRANCH,
+    [LIT_ADD] = &&L_LIT_ADD, [LIT_SUB] = &&L_LIT_SUB, [LIT_AND] = &&L_LIT_AND,
+    [LIT_EQ] = &&L_LIT_EQ, [LIT_RPICK] = &&L_LIT_RPICK,
+    [DLIT_ADD] = &&L_DLIT_ADD, [DLIT_SUB] = &&L_DLIT_SUB,
+    [DUP_EQ_ZERO] = &&L_DUP_EQ_ZERO, [OVER_ADD] = &&L_OVER_ADD,
+    [FETCH_ADD] = &&L_FETCH_ADD, [RDROP] = &&L_RDROP,
+    [ONE_ADD] = &&L_ONE_ADD, [ONE_SUB] = &&L_ONE_SUB,
+    [NUM_TO_STR] = &&L_NUM_TO_STR, [UNUM_TO_STR] = &&L_UNUM_TO_STR,
+    [NATIVE] = &&L_NATIVE,
+    [LAST_PRIMITIVE] = &&L_ILLEGAL,
+    [LAST_PRIMITIVE+1] = &&L_CALL
+  };
+  static void *oncetab[LAST_PRIMITIVE+2] = {
+    [0 ... LAST_PRIMITIVE+1] = &&L_ONCE
+  };
+  void **dtab = toplevelprim ? oncetab : optab;
+
+  CHECK_IP();
+  cmd = code[ip++];
+  OPSTAT(cmd);
+  goto *optab[cmd > LAST_PRIMITIVE ? LAST_PRIMITIVE+1 : cmd];
+#else
   while(1) {
     if (ip == 0) {
       tbforth_abort_request(ABORT_ILLEGAL);
       tbforth_abort(ip);		/* bad instruction */
       return E_ABORT;
     }
-    cmd = tbforth_dict[ip++];
+    cmd = code[ip++];
+    OPSTAT(cmd);
 
     switch (cmd) {
     case 0:
+#endif
+#ifdef THREADED_DISPATCH
+    L_ILLEGAL:
+#endif
       tbforth_abort_request(ABORT_ILLEGAL);
       tbforth_abort(ip-1);		/* bad instruction */
       return E_ABORT;
-    case ABORT:
+    OP(ABORT)
       tbforth_abort_request(ABORT_WORD);
-      break;
-    case IMMEDIATE:
+      DISPATCH_CHECKED();
+    OP(IMMEDIATE)
       make_immediate();
-      break;
-    case SKIP_IF_ZERO:
+      DISPATCH_CHECKED();
+    OP(INLINE)
+      if (!make_inline(MAX_DICT_CELLS)) tbforth_abort_request(ABORT_ILLEGAL);
+      DISPATCH_CHECKED();
+    OP(SKIP_IF_ZERO)
       r1 = dpop(); r2 = dpop();
       if (r2 == 0) ip += r1;
-      break;
-    case DUP:
+      DISPATCH();
+    OP(DUP)
       dpush(dtop());
-      break;
-    case SWAP:
+      DISPATCH();
+    OP(SWAP)
       r1 = dtop();
       dtop()=dtop2();
       dtop2()=r1;
-      break;
-    case OVER:
+      DISPATCH();
+    OP(OVER)
       dpush(dtop2());
-      break;
-    case DROP:
+      DISPATCH();
+    OP(DROP)
       (void)dpop();
-      break;
-    case ROT:
+      DISPATCH();
+    OP(ROT)
       r1 = dtop3();
       dtop3() = dtop();
       dtop() = r1;
-      break;
-    case JMP:
+      DISPATCH();
+    OP(JMP)
       ip = dpop();
-      break;
-    case JMP_IF_ZERO:
+      CHECK_IP();
+      DISPATCH();
+    OP(JMP_IF_ZERO)
       r1 = dpop(); r2 = dpop();
       if (r2 == 0) ip = r1;
-      break;
-    case HERE:
+      CHECK_IP();
+      DISPATCH();
+    OP(HERE)
       dpush(dict_here());
-      break;
-    case COLD:
+      DISPATCH();
+    OP(COLD)
+      SPILL();
       tbforth_init();
-      break;
-    case LIT:  
-      dpush(tbforth_dict[ip++]);
-      break;
-    case DLIT:  
-      dpush((((uint32_t)tbforth_dict[ip])<<16) |
-	    (uint16_t)tbforth_dict[ip+1]); 
+      FILL();
+      DISPATCH_CHECKED();
+    OP(LIT)
+      dpush(code[ip++]);
+      DISPATCH();
+    OP(DLIT)
+      dpush((((uint32_t)code[ip])<<16) | (uint16_t)code[ip+1]);
       ip+=2;
-      break;
-    case INCR:
+      DISPATCH();
+    OP(INCR)
       dtop()++; 
-      break;
-    case DECR:
+      DISPATCH();
+    OP(DECR)
       dtop()--; 
-      break;
-    case ADD:
+      DISPATCH();
+    OP(ADD)
       r1 = dpop();
       dtop() += r1;
-      break;
-    case SUB:
+      DISPATCH();
+    OP(SUB)
       r1 = dpop();
       dtop() -= r1;
-      break;
-    case AND:
+      DISPATCH();
+    OP(AND)
       r1 = dpop();
       dtop() &= r1;
-      break;
-    case LSHIFT:
+      DISPATCH();
+    OP(LSHIFT)
       r1 = dpop(); 
       dtop() <<= r1;
-      break;
-    case RSHIFT:
+      DISPATCH();
+    OP(RSHIFT)
       r1 = dpop();
       dtop() >>= r1;
-      break;
-    case OR:
+      DISPATCH();
+    OP(OR)
       r1 = dpop(); 
       dtop() |= r1;
-      break;
-    case XOR:
+      DISPATCH();
+    OP(XOR)
       r1 = dpop(); 
       dtop() ^= r1;
-      break;
-    case INVERT:
+      DISPATCH();
+    OP(INVERT)
       dtop() = ~dtop();
-      break;
-    case MULT:
+      DISPATCH();
+    OP(MULT)
       r1 = dpop(); 
       dtop() *= r1;
-      break;
-    case DIV :
+      DISPATCH();
+    OP(DIV)
       r1 = dpop(); 
       dtop() /= r1;
-      break;
-    case MULT_DIV :
+      DISPATCH();
+    OP(MULT_DIV)
       {
 	uint64_t tmp;
 	tmp = dtop3() * dtop2();
 	r1 = dpop();
-	dpop(); dpop();
+	(void)dpop(); (void)dpop();
 	dpush(tmp/r1);
       }
-      break;
-    case MOD :
+      DISPATCH();
+    OP(MOD)
       r1 = dpop();
       dtop() %= r1;
-      break;
-    case RTOP:
+      DISPATCH();
+    OP(RTOP)
       dpush(rpick(0));
-      break;
-    case RPICK:
+      DISPATCH();
+    OP(RPICK)
       r1 = dpop();
       r2 = rpick(r1);
       dpush(r2);
-      break;
-    case EQ_ZERO:
+      DISPATCH();
+    OP(EQ_ZERO)
       dtop() = -(dtop() == 0);
-      break;
-    case GT_ZERO:
-      dtop() = -(dtop() > 0);
-      break;
-    case LT_ZERO:
-      dtop() = -(dtop() < 0);
-      break;
-    case LESS_THAN:
+      DISPATCH();
+    OP(GT_ZERO)
+      dtop() = -((int32_t)dtop() > 0);
+      DISPATCH();
+    OP(LT_ZERO)
+      dtop() = -((int32_t)dtop() < 0);
+      DISPATCH();
+    OP(LESS_THAN)
       r1 = dpop();
-      dtop() = -(dtop() < r1);
-      break;
-    case GREATER_THAN:
+      dtop() = -((int32_t)dtop() < (int32_t)r1);
+      DISPATCH();
+    OP(GREATER_THAN)
       r1 = dpop();
-      dtop() = -(dtop() > r1);
-      break;
-    case GREATER_THAN_EQ:
+      dtop() = -((int32_t)dtop() > (int32_t)r1);
+      DISPATCH();
+    OP(GREATER_THAN_EQ)
       r1 = dpop();
-      dtop() = -(dtop() >= r1);
-      break;
-    case EQ:
+      dtop() = -((int32_t)dtop() >= (int32_t)r1);
+      DISPATCH();
+    OP(EQ)
       r1 = dpop(); 
       dtop() = -(r1 == dtop());
-      break;
-    case RPUSH:
+      DISPATCH();
+    OP(RPUSH)
       rpush(dpop());
-      break;
-    case RPOP:
+      DISPATCH();
+    OP(RPOP)
       dpush(rpop());
-      break;
-    case RAM_BASE_ADDR:
+      DISPATCH();
+    OP(RAM_BASE_ADDR)
       dpush (0x80000000 | 0);
-      break;
-    case URAM_BASE_ADDR:
+      DISPATCH();
+    OP(URAM_BASE_ADDR)
       dpush(0x80000000 | (((char*)tbforth_uram - (char*)tbforth_ram)/4));
-      break;
-    case STORE_URAM_BASE_ADDR:
-      tbforth_uram = (struct tbforth_uram*) &tbforth_ram[0x7FFFFFFF & dpop()];
-      break;
-    case FETCH:
+      DISPATCH();
+    OP(STORE_URAM_BASE_ADDR)
+      r1 = dpop();
+      SPILL();
+      tbforth_uram = (struct tbforth_uram*) &tbforth_ram[0x7FFFFFFF & r1];
+      FILL();
+      DISPATCH();
+    OP(FETCH)
       r1 = dpop();
       if (r1 & 0x80000000) {
-	dpush(tbforth_ram[r1 & 0x7FFFFFFF]);
+	r1 &= 0x7FFFFFFF;
+	if (IN_STACKS(r1)) SPILL();
+	dpush(tbforth_ram[r1]);
       } else {
-	dpush(tbforth_dict[r1]);
+	r2 = tbforth_dict[r1];
+	if (r2 == NATIVE) r2 = tbforth_native_first(r1);
+	dpush(r2);
       }
-      break;
-    case STORE:
+      DISPATCH();
+    OP(STORE)
       r1 = dpop();
       r2 = dpop();
-      if (r1 & 0x80000000)
-	RAM_WRITE(0x7FFFFFFF & r1,r2);
-      else
+      if (r1 & 0x80000000) {
+	r1 &= 0x7FFFFFFF;
+	if (IN_STACKS(r1)) {
+	  SPILL();
+	  RAM_WRITE(r1,r2);
+	  FILL();
+	} else
+	  RAM_WRITE(r1,r2);
+      } else {
+	if (r1 < natives->hi) native_store(r1, r2);
 	DICT_WRITE(r1,r2);
-      break;
-    case EXEC:
+	/* e.g. forget-to-mark rewinding here/last_word_idx */
+	if (r1 < DICT_HEADER_WORDS) DICT_INDEX_INVALIDATE();
+      }
+      DISPATCH_CHECKED();
+    OP(EXEC)
       r1 = dpop();
       rpush(ip);
       ip = r1;
-      break;
-    case CHAR_A_ADDR_STORE:
+      CHECK_IP();
+      JIT_CALL(ip);
+      PROFILE_CALL(ip);
+      DISPATCH();
+    OP(CHAR_A_ADDR_STORE)
       r1 = dpop();
       if (r1 &  0x80000000)
 	A_REG =(char*)&tbforth_ram[0x7FFFFFFF & r1];
       else
 	A_REG =(char*)&tbforth_dict[r1];
-      break;
-    case CHAR_A_B_SWAP:
+      DISPATCH();
+    OP(CHAR_A_B_SWAP)
       {
 	char *T = A_REG;
 	A_REG = B_REG;
 	B_REG = T;
       }
-      break;
-    case CHAR_A_INCR:
+      DISPATCH();
+    OP(CHAR_A_INCR)
       A_REG+=dpop();
-      break;
-    case CHAR_A_FETCH:
+      DISPATCH();
+    OP(CHAR_A_FETCH)
       dpush(0xFF & *A_REG);
-      break;
-    case CHAR_A_STORE:
+      DISPATCH();
+    OP(CHAR_A_STORE)
+      NATIVE_WRITTEN_BYTES(A_REG, 1);
       *A_REG = dpop();
-      break;
-    case CHAR_A_FETCH_INCR:
+      DISPATCH();
+    OP(CHAR_A_FETCH_INCR)
       dpush(0xFF & *A_REG++);
-      break;
-    case CHAR_A_STORE_INCR:
+      DISPATCH();
+    OP(CHAR_A_STORE_INCR)
+      NATIVE_WRITTEN_BYTES(A_REG, 1);
       *A_REG++ = dpop();
-      break;
-    case CHAR_FETCH:
+      DISPATCH();
+    OP(CHAR_FETCH)
       r1 = dpop();
       r2 = dpop();
       if (r2 & 0x80000000)
@@ -673,17 +2051,28 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
 	str1 =(char*)&tbforth_dict[r2];
       str1+=r1;
       dpush(0xFF & *str1);
-      break;
-    case EXIT:
-      if (tbforth_uram->ridx > last_exec_rdix) return U_OK;
+      DISPATCH();
+    OP(NATIVE)			/* run the word's C function, then exit */
+      SPILL();
+      r1 = native_call(ip-1);
+      FILL();
+      if (r1 != U_OK) return (tbforth_stat)r1;
+      /* fallthrough */
+    OP(EXIT)
+      PROFILE_EXIT();
+      if (RIDX() > last_exec_rdix && tbforth_uram == uram0) {
+	SPILL();
+	return U_OK;
+      }
       ip = rpop();
-      break;
-    case CNEXT:
+      CHECK_IP();
+      DISPATCH();
+    OP(CNEXT)
       char1 = next_char();
       dpush(char1);
-      break;
-    case BYTE_COPY:
-    case BYTE_CMP:
+      DISPATCH();
+    OP(BYTE_COPY)
+    OP(BYTE_CMP)
       {
 	RAMC from, dest, fidx, didx, cnt;
 	cnt = dpop();
@@ -697,11 +2086,13 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
 	  (char*)&tbforth_dict[dest] + didx ;
 	if (cmd == BYTE_CMP)
 	  dpush(-(memcmp (str2, str1, cnt) == 0));
-	else
+	else {
+	  NATIVE_WRITTEN_BYTES(str2, cnt);
 	  memcpy (str2, str1, cnt);
+	}
       }
-      break;
-    case CHAR_STORE:
+      DISPATCH();
+    OP(CHAR_STORE)
       r1 = dpop();
       r2 = dpop();
       if (r2 & 0x80000000)
@@ -709,9 +2100,10 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
       else
 	str1 =(char*)&tbforth_dict[r2];
       str1+=r1;
+      NATIVE_WRITTEN_BYTES(str1, 1);
       *str1 = dpop();
-      break;
-    case CHAR_APPEND:
+      DISPATCH();
+    OP(CHAR_APPEND)
       r1 = dpop();
       if (r1 & 0x80000000) {
 	r1 &= 0x7FFFFFFF;
@@ -723,18 +2115,20 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
 	*str1 = char1;
       } else
 	tbforth_abort_request(ABORT_ILLEGAL);
-      break;
-    case COMMA_STRING:
+      DISPATCH_CHECKED();
+    OP(COMMA_STRING)
       if (tbforth_iram->state == COMPILING) {
 	DICT_APPEND(LIT);
 	DICT_APPEND(dict_here()+sizeof(RAMC)); /* address of counted string */
 
 	DICT_APPEND(LIT);
 	rpush(dict_here());	/* address holding adress  */
+	NATIVE_WRITTEN(dict_here(), 1);
 	dict_incr_here(1);	/* place holder for jump address */
 	DICT_APPEND(JMP);
       }
       rpush(dict_here());
+      NATIVE_WRITTEN(dict_here(), 1);
       dict_incr_here(1);	/* place holder for count*/
       r1 = 0;
       do {
@@ -754,25 +2148,28 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
       if (tbforth_iram->state == COMPILING) {
 	DICT_WRITE(rpop(),dict_here());	/* jump over string */
       }
-      break;
-    case NEXT:
+      DISPATCH_CHECKED();
+    OP(NEXT)
       str2 = PAD_STR;
       str1 = tbforth_next_word();
       memcpy(str2,str1, tbforth_iram->tibwordlen);
       PAD_STRLEN = tbforth_iram->tibwordlen;		/* length */
       dpush(PAD_ADDR | 0x80000000);
-      break;
-    case CALLC:
-      r1 = c_handle();
+      DISPATCH();
+    OP(CALLC)
+      SPILL();
+      r1 = tbforth_cur_vm->c_handle ?
+	tbforth_cur_vm->c_handle(tbforth_cur_vm) : c_handle();
+      FILL();
       if (r1 != U_OK) return (tbforth_stat)r1;
-      break;
-    case VAR_ALLOT:
+      DISPATCH_CHECKED();
+    OP(VAR_ALLOT)
       dpush(VAR_ALLOT_1() | 0x80000000);
-      break;
-    case DEF:
+      DISPATCH();
+    OP(DEF)
       tbforth_iram->state = COMPILING;
       /* fallthrough */
-    case _CREATE:
+    OP(_CREATE)
       dict_start_def();
       tbforth_next_word();
       make_word(CURR_TIB_WORD,tbforth_iram->tibwordlen);
@@ -781,16 +2178,16 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
       } else {
 	tbforth_iram->compiling_word = dict_here();
       }
-      break;
-    case COMMA:
+      DISPATCH_CHECKED();
+    OP(COMMA)
       DICT_APPEND(dpop());
-      break;
-    case DCOMMA:
+      DISPATCH_CHECKED();
+    OP(DCOMMA)
       r1 = dpop();
       DICT_APPEND((uint32_t)r1>>16);
       DICT_APPEND(r1);
-      break;
-    case PARSE_NUM:
+      DISPATCH_CHECKED();
+    OP(PARSE_NUM)
       r1 = dpop();
       if (r1 & 0x80000000) {
 	r1 &= 0x7FFFFFFF;
@@ -803,9 +2200,12 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
       r2 = parse_num_cstr(str1, r2, tbforth_uram->base);
       if (!tbforth_aborting()) 
 	dpush(r2);
-      else return E_NOT_A_NUM;
-      break;
-    case FIND:
+      else {
+	SPILL();
+	return E_NOT_A_NUM;
+      }
+      DISPATCH();
+    OP(FIND)
       r1 = dpop();
       str1=tbforth_count_str((CELL)r1,(CELL*)&r1);
       r1 = find_word(str1, r1, &r2, 0, &char1);
@@ -813,9 +2213,9 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
 	if (char1) r1 = tbforth_dict[r1];
       }
       dpush(r2); dpush(r1);
-      break;
-    case UNUM_TO_STR:
-    case NUM_TO_STR:			/* 32bit to string */
+      DISPATCH();
+    OP(UNUM_TO_STR)
+    OP(NUM_TO_STR)			/* 32bit to string */
       {
 	if (cmd == UNUM_TO_STR)
 	  u32toa(dpop(),PAD_STR,tbforth_uram->base);
@@ -824,15 +2224,225 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
 	PAD_STRLEN=strlen(PAD_STR);
 	dpush(PAD_ADDR | 0x80000000);
       }
-      break;
-    case INTERP:
-      dpush (interpret_tib());
-      break;
+      DISPATCH();
+    OP(INTERP)
+      SPILL();
+      r1 = interpret_tib();
+      FILL();
+      dpush(r1);
+      DISPATCH_CHECKED();
+    OP(SPAWN)			/* ( xt uram - task ) */
+      r1 = dpop();
+      dtop() = tbforth_spawn(dtop(), 0x7FFFFFFF & r1);
+      DISPATCH();
+    OP(RESUME)			/* ( task - ) */
+      r1 = dpop();
+      if (r1 < MAX_TASKS && sched->state[r1] == TASK_SUSPENDED)
+	sched_ready(r1);
+      DISPATCH();
+    OP(TASK_ID)
+      dpush(sched->current);
+      DISPATCH();
+    OP(SUSPEND)
+      if (sched->current == 0) DISPATCH(); /* the interpreter can't */
+      sched->state[sched->current] = TASK_SUSPENDED;
+      goto task_switch;
+    OP(TASK_END)
+      if (sched->current == 0) DISPATCH();
+      sched->state[sched->current] = TASK_FREE;
+      goto task_switch;
+    OP(SLEEP_MS)		/* ( ms - ) */
+      r1 = dpop();
+      SPILL();
+      r1 += sched_now();
+      goto task_sleep;
+    OP(AT_MS)			/* ( ms - ) wake up when ms says so */
+      r1 = dpop();
+      SPILL();
+    task_sleep:
+      if (native_depth) goto native_switch;
+      sched_sleep(r1);
+      goto task_switch;
+    OP(PROFILE)
+      SPILL();
+      profile_op();
+      FILL();
+      DISPATCH();
+    OP(OPSTATS)
+      SPILL();
+      opstats_op();
+      FILL();
+      DISPATCH();
+    OP(WAIT_FD)			/* ( fd events - ) then yield */
+      sched->events = dpop();
+      sched->wake[sched->current] = dpop();
+      sched->state[sched->current] = TASK_WAITING;
+      sched->nwait++;
+      DISPATCH();
+    OP(YIELD)
+      if ((sched->count == 0 && sched->nsleep == 0 && sched->nwait == 0) ||
+	  native_depth)
+	DISPATCH();
+    task_switch:
+      if (native_depth) {
+      native_switch:
+	/* a native word (C stack frame) under us can't be parked */
+	tbforth_abort_request(ABORT_ILLEGAL);
+	DISPATCH_CHECKED();
+      }
+      /*
+	Park our ip on our return stack and pick up the next task's.
+	Called straight from the interpreter there is no ip to come back
+	to, so we come back to an EXIT (the code of ";") instead.
+      */
+#ifdef THREADED_DISPATCH
+      if (dtab == oncetab) {
+	rpush(find_word(";", 1, 0, 0, 0));
+	dtab = optab;
+      } else {
+#else
+      if (toplevelprim) {
+	rpush(find_word(";", 1, 0, 0, 0));
+	toplevelprim = 0;
+      } else {
+#endif
+	rpush(ip);
+      }
+      SPILL();
+      sched_switch();
+      FILL();
+      ip = rpop();
+      CHECK_IP();
+      DISPATCH();
+    OP(ZERO)
+      dpush(0);
+      DISPATCH();
+    OP(ONE)
+      dpush(1);
+      DISPATCH();
+    OP(TWO)
+      dpush(2);
+      DISPATCH();
+    OP(MINUS_ONE)
+      dpush(-1);
+      DISPATCH();
+
+      /*
+	Superinstructions: ip points just past the fused opcode, at the rest
+	of the original sequence (see fuse_def()).
+      */
+    OP(RLOOP)			/* r> 1- dup >r 0< lit <a> 0jmp? */
+      r1 = --rpick(0);
+      if ((int32_t)r1 >= 0) ip = code[ip+5]; else ip += 7;
+      DISPATCH();
+    OP(LOOP1)			/* 1 r> + dup >r 1 rpick >= lit <a> 0jmp? */
+      r1 = ++rpick(0);
+      if ((int32_t)r1 >= (int32_t)rpick(1)) ip += 12; else ip = code[ip+10];
+      DISPATCH();
+    OP(PLOOP)			/* r> + dup >r 1 rpick >= lit <a> 0jmp? */
+      r1 = (rpick(0) += dpop());
+      if ((int32_t)r1 >= (int32_t)rpick(1)) ip += 10; else ip = code[ip+8];
+      DISPATCH();
+    OP(ZBRANCH)			/* lit <a> 0jmp? */
+      if (dpop() == 0) ip = code[ip]; else ip += 2;
+      CHECK_IP();
+      DISPATCH();
+    OP(BRANCH)			/* lit <a> jmp */
+      ip = code[ip];
+      CHECK_IP();
+      DISPATCH();
+    OP(LIT_ADD)
+      dtop() += code[ip];
+      ip += 2;
+      DISPATCH();
+    OP(LIT_SUB)
+      dtop() -= code[ip];
+      ip += 2;
+      DISPATCH();
+    OP(LIT_AND)
+      dtop() &= code[ip];
+      ip += 2;
+      DISPATCH();
+    OP(LIT_EQ)
+      dtop() = -(dtop() == code[ip]);
+      ip += 2;
+      DISPATCH();
+    OP(LIT_RPICK)
+      dpush(rpick(code[ip]));
+      ip += 2;
+      DISPATCH();
+    OP(DLIT_ADD)
+      dtop() += (((uint32_t)code[ip])<<16) | (uint16_t)code[ip+1];
+      ip += 3;
+      DISPATCH();
+    OP(DLIT_SUB)
+      dtop() -= (((uint32_t)code[ip])<<16) | (uint16_t)code[ip+1];
+      ip += 3;
+      DISPATCH();
+    OP(DUP_EQ_ZERO)
+      dpush(-(dtop() == 0));
+      ip += 1;
+      DISPATCH();
+    OP(OVER_ADD)
+      dtop() += dtop2();
+      ip += 1;
+      DISPATCH();
+    OP(FETCH_ADD)
+      r1 = dpop();
+      if (r1 & 0x80000000) {
+	r1 &= 0x7FFFFFFF;
+	if (IN_STACKS(r1)) SPILL();
+	dtop() += tbforth_ram[r1];
+      } else {
+	r2 = tbforth_dict[r1];
+	if (r2 == NATIVE) r2 = tbforth_native_first(r1);
+	dtop() += r2;
+      }
+      ip += 1;
+      DISPATCH();
+    OP(RDROP)
+      (void)rpop();
+      ip += 1;
+      DISPATCH();
+    OP(ONE_ADD)
+      dtop()++;
+      ip += 1;
+      DISPATCH();
+    OP(ONE_SUB)
+      dtop()--;
+      ip += 1;
+      DISPATCH();
+#ifdef THREADED_DISPATCH
+    L_CALL:
+      /* Execute user word by calling until we reach primitives */
+      rpush(ip);
+      ip = cmd;			/* cmd is the current word */
+      JIT_CALL(ip);
+      PROFILE_CALL(ip);
+      DISPATCH();
+    L_BADIP:
+      tbforth_abort_request(ABORT_ILLEGAL);
+      tbforth_abort(ip);		/* bad instruction */
+      return E_ABORT;
+    L_ONCE:
+      /* toplevelprim: we just ran the one primitive asked for */
+      --ip;
+      if (!tbforth_aborting()) {
+	SPILL();
+	return U_OK;
+      }
+      /* fallthrough */
+    L_ABORTING:
+      tbforth_abort(ip-1);
+      return E_ABORT;
+#else
     default:
       if (cmd > LAST_PRIMITIVE) {
 	/* Execute user word by calling until we reach primitives */
 	rpush(ip);
 	ip = tbforth_dict[ip-1]; /* ip-1 is current word */
+	JIT_CALL(ip);
+	PROFILE_CALL(ip);
 	//	goto CHECK_STAT;
       } else {
 	tbforth_abort_request(ABORT_ILLEGAL);
@@ -843,15 +2453,43 @@ tbforth_stat exec(CELL ip, bool toplevelprim,uint8_t last_exec_rdix) {
       tbforth_abort(ip-1);
       return E_ABORT;
     }
-    if (toplevelprim) return U_OK;
+    if (toplevelprim) {
+      SPILL();
+      return U_OK;
+    }
   } /* while(1) */
+#endif
 }
 
+#ifdef TOS_CACHE
+# pragma pop_macro("dpush")
+# pragma pop_macro("dpop")
+# pragma pop_macro("dpick")
+# pragma pop_macro("rpush")
+# pragma pop_macro("rpop")
+# pragma pop_macro("rpick")
+# pragma pop_macro("dtop")
+# pragma pop_macro("dtop2")
+# pragma pop_macro("dtop3")
+#endif
+
 CELL find_word(char* s, uint8_t slen, RAMC* addr, bool *immediate, char *primitive) {
   CELL fidx = dict->last_word_idx;
   CELL prev = fidx;
   uint8_t wlen;
 
+#ifdef DICT_HASH_SLOTS
+  if (dict_index_sync()) {
+    fidx = dict_index_find(s, slen);
+    if (addr != 0) *addr = fidx;
+    if (fidx == 0) return 0;
+    wlen = tbforth_dict[fidx+1];
+    if (immediate) *immediate = (wlen & IMMEDIATE_BIT) ? 1 : 0;
+    if (primitive) *primitive = (wlen & PRIM_BIT) ? 1 : 0;
+    wlen &= WORD_LEN_BITS;
+    return fidx + 2 + (wlen / BYTES_PER_CELL) + (wlen % BYTES_PER_CELL);
+  }
+#endif
   while (fidx != 0) {
     if (addr != 0) *addr = prev ;
     prev = tbforth_dict[fidx++];
@@ -869,16 +2507,40 @@ CELL find_word(char* s, uint8_t slen, RAMC* addr, bool *immediate, char *primiti
   return 0;
 }
 
+/*
+  Lay down a number with the smallest encoding: a one cell opcode for the
+  most common small numbers, LIT for 0..$FFFF and DLIT for everything else.
+  LIT is not sign extended (it also carries dictionary addresses), so
+  negative numbers (other than -1) need DLIT.
+*/
+static void compile_num(RAMC num) {
+  switch ((int32_t)num) {
+  case 0: DICT_APPEND(ZERO); return;
+  case 1: DICT_APPEND(ONE); return;
+  case 2: DICT_APPEND(TWO); return;
+  case -1: DICT_APPEND(MINUS_ONE); return;
+  }
+  if (num <= 0xFFFF) {
+    DICT_APPEND(LIT);
+    DICT_APPEND(num);
+  } else {
+    DICT_APPEND(DLIT);
+    DICT_APPEND(((uint32_t)num)>>16);
+    DICT_APPEND(((uint16_t)num)&0xffff);
+  }
+}
+
 // Goal: Rewrite this in tbforth...
 //
 tbforth_stat interpret_tib(void) {
   tbforth_stat stat;
   char *word;
   CELL wd;
+  RAMC head = 0;
   bool immediate = 0;
   char primitive = 0;
   while(*(word = tbforth_next_word()) != 0) {
-    wd = find_word(word,tbforth_iram->tibwordlen,0,&immediate,&primitive);
+    wd = find_word(word,tbforth_iram->tibwordlen,&head,&immediate,&primitive);
     switch (tbforth_iram->state) {
     case 0:			/* interpret mode */
       if (wd == 0) {	/* number or trash */
@@ -906,12 +2568,16 @@ tbforth_stat interpret_tib(void) {
 	  dict_end_def();
 	  return E_NOT_A_WORD;
 	}
-	DICT_APPEND(DLIT);
-	DICT_APPEND(((uint32_t)num)>>16);
-	DICT_APPEND(((uint16_t)num)&0xffff);
+	compile_num(num);
       }	else if (word[0] == ';') { /* exit from a colon def */
 	tbforth_iram->state = 0;
 	DICT_APPEND(EXIT);
+#ifdef FUSE_SUPERINSTRUCTIONS
+	fuse_def(tbforth_iram->compiling_word, dict_here());
+#endif
+#if INLINE_MAX_CELLS
+	if (tbforth_iram->compiling_word) (void)make_inline(INLINE_MAX_CELLS);
+#endif
 	dict_end_def();
 	tbforth_iram->compiling_word = 0;
       } else if (immediate) {	/* run immediate word */
@@ -926,6 +2592,9 @@ tbforth_stat interpret_tib(void) {
 	if (primitive) {
 	  /* OPTIMIZATION: inline primitive */
 	  DICT_APPEND(tbforth_dict[wd]);
+	} else if (tbforth_dict[head+1] & INLINE_BIT) {
+	  /* OPTIMIZATION: inline short definition (see inline_end()) */
+	  compile_inline(wd);
 	} else {
 	  /* OPTIMIZATION: skip null definitions */
 	  if (tbforth_dict[wd] != EXIT) {
@@ -952,8 +2621,1214 @@ tbforth_stat interpret_tib(void) {
 }
 
 tbforth_stat tbforth_interpret(char *str) {
+  RAMC len = strlen(str);
+
+  if (len >= TIB_SIZE)		/* won't fit: read it where it is */
+    return tbforth_interpret_src(str, len);
+  tbforth_src = NULL;
   CLEAR_TIB();
-  tbforth_iram->tibclen = min(PAD_SIZE_BYTES, strlen(str)+1);
+  tbforth_iram->tibclen = len+1;
   memcpy(tbforth_iram->tib, str, tbforth_iram->tibclen);
   return interpret_tib();
 }
+
+/*
+  Interpret len bytes at src where they are (say a line of a mapped
+  file) instead of copying them into the TIB. Calls nest (include): the
+  outer source carries on afterwards. After an error, TBFORTH_TIB and
+  tibwordidx are left pointing at it for the host to report.
+*/
+tbforth_stat tbforth_interpret_src(char *src, RAMC len) {
+  char *osrc = tbforth_src;
+  RAMC idx = tbforth_iram->tibidx, clen = tbforth_iram->tibclen;
+  RAMC widx = tbforth_iram->tibwordidx, wlen = tbforth_iram->tibwordlen;
+  tbforth_stat stat;
+
+  tbforth_src = src;
+  CLEAR_TIB();
+  tbforth_iram->tibclen = len;
+  stat = interpret_tib();
+  if (stat != U_OK) return stat;
+  tbforth_src = osrc;
+  tbforth_iram->tibidx = idx;
+  tbforth_iram->tibclen = clen;
+  tbforth_iram->tibwordidx = widx;
+  tbforth_iram->tibwordlen = wlen;
+  return stat;
+}
+
+#if defined(TBFORTH_AOT) || defined(TBFORTH_JIT)
+/*
+  The ahead of time translator (tbforth-aot): every colon definition in
+  the dictionary whose branches are all static and whose return stack
+  use balances becomes a C function working on the real stacks (see the
+  macros in aot_prologue). Literals, stack, arithmetic, compares, return
+  stack, @ and ! on RAM, branches and loops are open coded. Calls go
+  straight to the callee's function while it is installed, or else
+  through exec(). Any other primitive runs in exec() by itself, through
+  its word (tbforth_native_prim()).
+  Words that may get to a task switch (yield, sleep-ms, cf, interpret,
+  exec of something unknown...), directly or through what they call,
+  are left to the interpreter: a switch can't park a C stack frame.
+  The JIT (TBFORTH_JIT) uses the same analysis, and does the same in
+  machine code.
+*/
+#define AOT_MAX_WORDS 4096
+#define AOT_MAX_CALLS 16384
+
+enum { K_LIT, K_OP, K_CALL, K_BRANCH, K_ZBRANCH, K_LOOP, K_EXIT };
+
+struct aot_op {
+  uint8_t kind;
+  CELL op;			/* K_OP, K_LOOP */
+  CELL len;			/* cells taken */
+  CELL target;			/* branches, K_CALL */
+  RAMC val;			/* K_LIT, fused literals */
+};
+
+struct aot_word {
+  CELL head, xt, limit;		/* limit: where the next word starts */
+  CELL end;			/* past the last instruction reached */
+  bool ok;			/* translatable by itself */
+  bool switches;		/* may get to a task switch */
+  uint16_t calls, ncalls;	/* in aot_calls */
+};
+
+static struct aot_word aot_words[AOT_MAX_WORDS];
+static uint16_t aot_nwords;
+static CELL aot_calls[AOT_MAX_CALLS];
+static uint16_t aot_ncalls;
+static CELL aot_prim[LAST_PRIMITIVE+1];	/* code of each primitive's word */
+static CELL aot_prim_head[LAST_PRIMITIVE+1];
+static int16_t aot_depth[MAX_DICT_CELLS]; /* return stack depth (-1: unseen) */
+static uint8_t aot_cell[MAX_DICT_CELLS];
+#define AOT_START 1			/* an instruction starts here */
+#define AOT_TARGET 2			/* something branches here */
+#define AOT_TAKEN 4			/* part of an instruction */
+
+#ifdef TBFORTH_AOT
+static const char aot_prologue[] =
+  "#include \"tbforth.h\"\n"
+  "\n"
+  "#if DICT_VERSION != %d\n"
+  "#error \"translated for another dictionary version\"\n"
+  "#endif\n"
+  "#define N_NATIVE %d\n"
+  "#ifdef GUARD_RAILS\n"
+  "#define N_GUARDED 1\n"
+  "#else\n"
+  "#define N_GUARDED 0\n"
+  "#endif\n"
+  "\n"
+  "/* sp: top of data stack, rp: top of return stack, re: rp on entry */\n"
+  "#define ENTER() RAMC *ds, *sp, *rp, re, t; tbforth_stat st; \\\n"
+  "  FILL(); re = rp - ds; (void)t; (void)st; (void)re\n"
+  "#define SPILL() (tbforth_uram->didx = sp - ds, tbforth_uram->ridx = rp - ds)\n"
+  "#define FILL() (ds = tbforth_uram->ds, \\\n"
+  "  sp = ds + (int32_t)tbforth_uram->didx, rp = ds + tbforth_uram->ridx)\n"
+  "#define RETURN() do { SPILL(); return U_OK; } while (0)\n"
+  "#define PRIM(px) do { \\\n"
+  "    SPILL(); \\\n"
+  "    if ((st = tbforth_native_prim(px)) != U_OK) return st; \\\n"
+  "    FILL(); \\\n"
+  "  } while (0)\n"
+  "/* Call xt with ret on the return stack, as the interpreter would */\n"
+  "#define CALL_(call, ret) do { \\\n"
+  "    RAMC r_ = rp - ds; \\\n"
+  "    *--rp = (ret); \\\n"
+  "    SPILL(); \\\n"
+  "    if ((st = call) != U_OK) return st; \\\n"
+  "    FILL(); \\\n"
+  "    if ((RAMC)(rp - ds) != r_ - 1 || *rp != (ret)) \\\n"
+  "      return tbforth_native_return(re, r_); \\\n"
+  "    rp++; \\\n"
+  "  } while (0)\n"
+  "#define CALL(xt, fn, ret) \\\n"
+  "  CALL_(tbforth_dict[xt] == N_NATIVE ? fn() : tbforth_native_exec(xt), ret)\n"
+  "#define XCALL(xt, ret) CALL_(tbforth_native_exec(xt), ret)\n"
+  "#define FETCH() do { \\\n"
+  "    t = *sp--; \\\n"
+  "    if (t & 0x80000000) { \\\n"
+  "      SPILL(); \\\n"
+  "      t = tbforth_ram[t & 0x7FFFFFFF]; \\\n"
+  "    } else if (tbforth_dict[t] == N_NATIVE) \\\n"
+  "      t = tbforth_native_first(t); \\\n"
+  "    else \\\n"
+  "      t = tbforth_dict[t]; \\\n"
+  "    *++sp = t; \\\n"
+  "  } while (0)\n"
+  "#define STORE(px) do { \\\n"
+  "    t = *sp; \\\n"
+  "    if ((t & 0x80000000) && !N_GUARDED) { \\\n"
+  "      sp -= 2; \\\n"
+  "      SPILL(); \\\n"
+  "      tbforth_ram[t & 0x7FFFFFFF] = sp[1]; \\\n"
+  "      FILL(); \\\n"
+  "    } else \\\n"
+  "      PRIM(px); \\\n"
+  "  } while (0)\n"
+  "\n";
+#endif
+
+/* What's at a, as compiled (see tbforth_native_first()) */
+static CELL aot_at(CELL a) {
+  return tbforth_dict[a] == NATIVE ? tbforth_native_first(a) : tbforth_dict[a];
+}
+
+/* A number laid down at a (see compile_num()), n cells */
+static bool aot_literal(CELL a, RAMC *val, CELL *n) {
+  switch (aot_at(a)) {
+  case LIT: *val = tbforth_dict[a+1]; *n = 2; return 1;
+  case DLIT:
+    *val = ((RAMC)tbforth_dict[a+1] << 16) | tbforth_dict[a+2];
+    *n = 3;
+    return 1;
+  case ZERO: *val = 0; break;
+  case ONE: *val = 1; break;
+  case TWO: *val = 2; break;
+  case MINUS_ONE: *val = -1; break;
+  default: return 0;
+  }
+  *n = 1;
+  return 1;
+}
+
+/* The instruction at a. A literal and the jump (or exec) after it make one. */
+static void aot_decode(CELL a, struct aot_op *o) {
+  CELL c = aot_at(a), n;
+  RAMC v;
+
+  memset(o, 0, sizeof(*o));
+  o->kind = K_OP;
+  o->op = c;
+  o->len = 1;
+  if (c > LAST_PRIMITIVE) {
+    o->kind = K_CALL;
+    o->target = c;
+    return;
+  }
+  if (aot_literal(a, &v, &n)) {
+    o->len = n + 1;
+    o->target = v;
+    switch (tbforth_dict[a+n]) {
+    case JMP: o->kind = K_BRANCH; return;
+    case JMP_IF_ZERO: o->kind = K_ZBRANCH; return;
+    case SKIP_IF_ZERO: o->kind = K_ZBRANCH; o->target = a + n + 1 + v; return;
+    case EXEC: o->kind = K_CALL; return;
+    }
+    o->kind = K_LIT;
+    o->val = v;
+    o->len = n;
+    return;
+  }
+  switch (c) {
+  case EXIT: o->kind = K_EXIT; break;
+  case BRANCH: o->kind = K_BRANCH; o->target = tbforth_dict[a+1]; o->len = 3; break;
+  case ZBRANCH: o->kind = K_ZBRANCH; o->target = tbforth_dict[a+1]; o->len = 3; break;
+  case RLOOP: o->kind = K_LOOP; o->target = tbforth_dict[a+6]; o->len = 8; break;
+  case LOOP1: o->kind = K_LOOP; o->target = tbforth_dict[a+11]; o->len = 13; break;
+  case PLOOP: o->kind = K_LOOP; o->target = tbforth_dict[a+9]; o->len = 11; break;
+  case LIT_ADD: case LIT_SUB: case LIT_AND: case LIT_EQ: case LIT_RPICK:
+    o->val = tbforth_dict[a+1];
+    o->len = 3;
+    break;
+  case DLIT_ADD: case DLIT_SUB:
+    o->val = ((RAMC)tbforth_dict[a+1] << 16) | tbforth_dict[a+2];
+    o->len = 4;
+    break;
+  case DUP_EQ_ZERO: case OVER_ADD: case FETCH_ADD: case RDROP:
+  case ONE_ADD: case ONE_SUB:
+    o->len = 2;
+    break;
+  }
+}
+
+static struct aot_word *aot_word_at(CELL xt) {
+  int lo = 0, hi = aot_nwords - 1, m;
+  while (lo <= hi) {
+    m = (lo + hi) / 2;
+    if (xt < aot_words[m].xt) hi = m - 1;
+    else if (xt > aot_words[m].xt) lo = m + 1;
+    else return &aot_words[m];
+  }
+  return 0;
+}
+
+/* Opcodes run as they are (by exec()) that may switch tasks */
+static bool aot_switches(CELL op) {
+  switch (op) {
+  case YIELD: case SUSPEND: case TASK_END: case SLEEP_MS: case AT_MS:
+  case WAIT_FD: case CALLC: case INTERP: case EXEC: case COLD:
+  case STORE_URAM_BASE_ADDR:
+    return 1;
+  }
+  return 0;
+}
+
+/* Opcodes open coded by aot_emit() (the rest need their word) */
+static bool aot_open_coded(CELL op) {
+  switch (op) {
+  case DROP: case DUP: case SWAP: case OVER: case ROT: case INCR: case DECR:
+  case ADD: case SUB: case AND: case OR: case XOR: case MULT: case DIV:
+  case MULT_DIV: case MOD: case LSHIFT: case RSHIFT: case INVERT:
+  case EQ_ZERO: case GT_ZERO: case LT_ZERO: case LESS_THAN: case GREATER_THAN:
+  case GREATER_THAN_EQ: case EQ: case RTOP: case RPICK: case RPUSH: case RPOP:
+  case FETCH: case LIT_ADD: case LIT_SUB: case LIT_AND: case LIT_EQ:
+  case LIT_RPICK: case DLIT_ADD: case DLIT_SUB: case DUP_EQ_ZERO:
+  case OVER_ADD: case FETCH_ADD: case RDROP: case ONE_ADD: case ONE_SUB:
+    return 1;
+  }
+  return 0;
+}
+
+/*
+  Follow the code of w from its xt: find its instructions, check that
+  every branch lands on one inside w, that the return stack depth is the
+  same whichever way we get somewhere and is 0 at each exit.
+*/
+static void aot_analyse(struct aot_word *w) {
+  static CELL todo[2*MAX_DICT_CELLS];
+  int ntodo = 0;
+  CELL a, i;
+  int16_t d, need;
+  struct aot_op o;
+
+  w->ok = 1;
+  w->calls = aot_ncalls;
+  w->end = w->xt;
+  memset(&aot_depth[w->xt], 0xFF, (w->limit - w->xt) * sizeof(aot_depth[0]));
+  memset(&aot_cell[w->xt], 0, w->limit - w->xt);
+  aot_depth[w->xt] = 0;
+  todo[ntodo++] = w->xt;
+
+  while (ntodo > 0 && w->ok) {
+    a = todo[--ntodo];
+    if (a < w->xt || a >= w->limit) goto bad;
+    if (aot_cell[a] & AOT_START) continue;
+    aot_decode(a, &o);
+    d = aot_depth[a];
+    if (a + o.len > w->limit) goto bad;
+    for (i = a; i < a + o.len; i++) {
+      if (aot_cell[i] & AOT_TAKEN) goto bad; /* overlaps another */
+      aot_cell[i] |= AOT_TAKEN;
+    }
+    aot_cell[a] |= AOT_START;
+    if (a + o.len > w->end) w->end = a + o.len;
+
+    need = 0;
+    switch (o.kind) {
+    case K_CALL:
+      if (aot_ncalls == AOT_MAX_CALLS || aot_word_at(o.target) == 0)
+	goto bad;
+      aot_calls[aot_ncalls++] = o.target;
+      break;
+    case K_EXIT:
+      if (d != 0) goto bad;
+      continue;
+    case K_LOOP:
+      need = o.op == RLOOP ? 1 : 2;
+      break;
+    case K_OP:
+      if (aot_switches(o.op)) w->switches = 1;
+      switch (o.op) {
+      case RPUSH: d++; break;
+      case RPOP: case RDROP: need = 1; d--; break;
+      case RTOP: need = 1; break;
+      case JMP: case JMP_IF_ZERO: case SKIP_IF_ZERO: /* computed */
+	goto bad;
+      default:
+	if (!aot_open_coded(o.op) && aot_prim[o.op] == 0) goto bad;
+      }
+      break;
+    }
+    if (aot_depth[a] < need) goto bad;
+
+    if (o.kind == K_BRANCH || o.kind == K_ZBRANCH || o.kind == K_LOOP) {
+      if (o.target < w->xt || o.target >= w->limit) goto bad;
+      if (aot_depth[o.target] >= 0 && aot_depth[o.target] != d) goto bad;
+      aot_depth[o.target] = d;
+      aot_cell[o.target] |= AOT_TARGET;
+      todo[ntodo++] = o.target;
+    }
+    if (o.kind != K_BRANCH) {
+      if (a + o.len >= w->limit) goto bad;
+      if (aot_depth[a + o.len] >= 0 && aot_depth[a + o.len] != d) goto bad;
+      aot_depth[a + o.len] = d;
+      todo[ntodo++] = a + o.len;
+    }
+  }
+  /* every branch lands on an instruction */
+  for (a = w->xt; a < w->end && w->ok; a++)
+    if ((aot_cell[a] & AOT_TARGET) && !(aot_cell[a] & AOT_START)) goto bad;
+  w->ncalls = aot_ncalls - w->calls;
+  return;
+ bad:
+  /* What could it call or run? Read it all, data and all, to be sure. */
+  w->ok = 0;
+  aot_ncalls = w->calls;
+  for (a = w->xt; a < w->limit; a += o.len) {
+    aot_decode(a, &o);
+    if (o.kind == K_OP && aot_switches(o.op)) w->switches = 1;
+    if (o.kind == K_CALL && aot_word_at(o.target) && aot_ncalls < AOT_MAX_CALLS)
+      aot_calls[aot_ncalls++] = o.target;
+  }
+  w->ncalls = aot_ncalls - w->calls;
+}
+
+static bool aot_native(struct aot_word *w) {
+  return w->ok && !w->switches;
+}
+
+static int aot_cmp_cell(const void *x, const void *y) {
+  return (int)*(const CELL*)x - (int)*(const CELL*)y;
+}
+
+/*
+  Find the colon definitions (and primitives' words) in the dictionary,
+  and which of them can be native.
+*/
+static void aot_build(void) {
+  static CELL heads[AOT_MAX_WORDS];
+  uint16_t nheads = 0, i;
+  CELL h, xt, limit, a, len;
+  struct aot_word *w;
+  bool changed;
+
+  for (h = dict->last_word_idx; h != 0 && nheads < AOT_MAX_WORDS; h = tbforth_dict[h])
+    heads[nheads++] = h;
+  qsort(heads, nheads, sizeof(heads[0]), aot_cmp_cell);
+
+  aot_nwords = aot_ncalls = 0;
+  memset(aot_prim, 0, sizeof(aot_prim));
+  for (i = 0; i < nheads; i++) {
+    len = tbforth_dict[heads[i]+1];
+    xt = heads[i] + 2 + ((len & WORD_LEN_BITS) + 1) / 2;
+    limit = i+1 < nheads ? heads[i+1] : dict_here();
+    if (len & PRIM_BIT) {
+      if (tbforth_dict[xt] <= LAST_PRIMITIVE) {
+	aot_prim[tbforth_dict[xt]] = xt;
+	aot_prim_head[tbforth_dict[xt]] = heads[i];
+      }
+      continue;
+    }
+    if (xt >= limit) continue;
+    w = &aot_words[aot_nwords++];
+    memset(w, 0, sizeof(*w));
+    w->head = heads[i];
+    w->xt = xt;
+    w->limit = limit;
+  }
+  for (i = 0; i < aot_nwords; i++) {
+    w = &aot_words[i];
+    /* deferred words (and the like): is may point them anywhere */
+    if (w->limit - w->xt == 2 && tbforth_dict[w->xt+1] == EXIT &&
+	(tbforth_dict[w->xt] == EXIT || tbforth_dict[w->xt] > LAST_PRIMITIVE)) {
+      w->switches = 1;
+      continue;
+    }
+    aot_analyse(w);
+  }
+  do {				/* through what they call */
+    changed = 0;
+    for (i = 0; i < aot_nwords; i++) {
+      w = &aot_words[i];
+      for (a = 0; a < w->ncalls && !w->switches; a++) {
+	if (aot_word_at(aot_calls[w->calls + a])->switches)
+	  w->switches = changed = 1;
+      }
+    }
+  } while (changed);
+}
+
+#ifdef TBFORTH_AOT
+/* A word's name, fit for a C comment */
+static void aot_name(FILE *fp, CELL head) {
+  uint8_t len = tbforth_dict[head+1] & WORD_LEN_BITS, i;
+  char *name = (char*)&tbforth_dict[head+2];
+  for (i = 0; i < len; i++) {
+    fputc(name[i], fp);
+    if (name[i] == '*' && i+1 < len && name[i+1] == '/') fputc(' ', fp);
+  }
+}
+
+static void aot_emit(FILE *fp, CELL a, struct aot_op *o) {
+  static const char *binop[LAST_PRIMITIVE] = {
+    [ADD] = "+", [SUB] = "-", [AND] = "&", [OR] = "|", [XOR] = "^",
+    [MULT] = "*", [DIV] = "/", [MOD] = "%", [LSHIFT] = "<<", [RSHIFT] = ">>"
+  };
+  static const char *cmp[LAST_PRIMITIVE] = {
+    [LESS_THAN] = "<", [GREATER_THAN] = ">", [GREATER_THAN_EQ] = ">="
+  };
+  struct aot_word *c;
+
+  switch (o->kind) {
+  case K_LIT:
+    fprintf(fp, "  *++sp = %uu;\n", o->val);
+    return;
+  case K_EXIT:
+    fprintf(fp, "  RETURN();\n");
+    return;
+  case K_BRANCH:
+    fprintf(fp, "  goto L%u;\n", o->target);
+    return;
+  case K_ZBRANCH:
+    fprintf(fp, "  if (*sp-- == 0) goto L%u;\n", o->target);
+    return;
+  case K_LOOP:
+    if (o->op == RLOOP)
+      fprintf(fp, "  if ((int32_t)--rp[0] >= 0) goto L%u;\n", o->target);
+    else if (o->op == LOOP1)
+      fprintf(fp, "  if ((int32_t)++rp[0] < (int32_t)rp[1]) goto L%u;\n", o->target);
+    else
+      fprintf(fp, "  if ((int32_t)(rp[0] += *sp--) < (int32_t)rp[1]) goto L%u;\n",
+	      o->target);
+    return;
+  case K_CALL:
+    c = aot_word_at(o->target);
+    if (aot_native(c))
+      fprintf(fp, "  CALL(%u, w_%u, %u);", c->xt, c->xt, a + o->len);
+    else
+      fprintf(fp, "  XCALL(%u, %u);", c->xt, a + o->len);
+    fprintf(fp, "\t/* ");
+    aot_name(fp, c->head);
+    fprintf(fp, " */\n");
+    return;
+  }
+
+  if (binop[o->op]) {
+    fprintf(fp, "  sp[-1] %s= sp[0]; sp--;\n", binop[o->op]);
+    return;
+  }
+  if (cmp[o->op]) {
+    fprintf(fp, "  sp[-1] = -((int32_t)sp[-1] %s (int32_t)sp[0]); sp--;\n",
+	    cmp[o->op]);
+    return;
+  }
+  switch (o->op) {
+  case DROP: fprintf(fp, "  sp--;\n"); break;
+  case DUP: fprintf(fp, "  sp[1] = sp[0]; sp++;\n"); break;
+  case SWAP: fprintf(fp, "  t = sp[0]; sp[0] = sp[-1]; sp[-1] = t;\n"); break;
+  case OVER: fprintf(fp, "  sp[1] = sp[-1]; sp++;\n"); break;
+  case ROT: fprintf(fp, "  t = sp[-2]; sp[-2] = sp[0]; sp[0] = t;\n"); break;
+  case INCR: case ONE_ADD: fprintf(fp, "  sp[0]++;\n"); break;
+  case DECR: case ONE_SUB: fprintf(fp, "  sp[0]--;\n"); break;
+  case MULT_DIV:
+    fprintf(fp, "  sp[-2] = (RAMC)(sp[-2] * sp[-1]) / sp[0]; sp -= 2;\n");
+    break;
+  case INVERT: fprintf(fp, "  sp[0] = ~sp[0];\n"); break;
+  case EQ_ZERO: fprintf(fp, "  sp[0] = -(sp[0] == 0);\n"); break;
+  case GT_ZERO: fprintf(fp, "  sp[0] = -((int32_t)sp[0] > 0);\n"); break;
+  case LT_ZERO: fprintf(fp, "  sp[0] = -((int32_t)sp[0] < 0);\n"); break;
+  case EQ: fprintf(fp, "  sp[-1] = -(sp[-1] == sp[0]); sp--;\n"); break;
+  case RTOP: fprintf(fp, "  sp[1] = rp[0]; sp++;\n"); break;
+  case RPICK: fprintf(fp, "  sp[0] = rp[sp[0]];\n"); break;
+  case RPUSH: fprintf(fp, "  *--rp = *sp--;\n"); break;
+  case RPOP: fprintf(fp, "  *++sp = *rp++;\n"); break;
+  case RDROP: fprintf(fp, "  rp++;\n"); break;
+  case FETCH: fprintf(fp, "  FETCH();\n"); break;
+  case FETCH_ADD: fprintf(fp, "  FETCH(); sp[-1] += sp[0]; sp--;\n"); break;
+  case STORE: fprintf(fp, "  STORE(%u);\n", aot_prim[STORE]); break;
+  case LIT_ADD: fprintf(fp, "  sp[0] += %uu;\n", o->val); break;
+  case LIT_SUB: fprintf(fp, "  sp[0] -= %uu;\n", o->val); break;
+  case LIT_AND: fprintf(fp, "  sp[0] &= %uu;\n", o->val); break;
+  case LIT_EQ: fprintf(fp, "  sp[0] = -(sp[0] == %uu);\n", o->val); break;
+  case LIT_RPICK: fprintf(fp, "  sp[1] = rp[%u]; sp++;\n", o->val); break;
+  case DLIT_ADD: fprintf(fp, "  sp[0] += %uu;\n", o->val); break;
+  case DLIT_SUB: fprintf(fp, "  sp[0] -= %uu;\n", o->val); break;
+  case DUP_EQ_ZERO: fprintf(fp, "  sp[1] = -(sp[0] == 0); sp++;\n"); break;
+  case OVER_ADD: fprintf(fp, "  sp[0] += sp[-1];\n"); break;
+  default:
+    fprintf(fp, "  PRIM(%u);\t/* ", aot_prim[o->op]);
+    aot_name(fp, aot_prim_head[o->op]);
+    fprintf(fp, " */\n");
+  }
+}
+
+/*
+  Write the dictionary's colon definitions as C (tbforth_natives[], for
+  tbforth_native_install()). Returns how many were translated.
+*/
+uint16_t tbforth_aot(FILE *fp) {
+  uint16_t i, n = 0;
+  CELL a;
+  struct aot_word *w;
+  struct aot_op o;
+
+  aot_build();
+  fprintf(fp, "/*\n  The colon definitions of a tbforth dictionary (%u cells) as C,\n"
+	  "  by tbforth-aot (see tbforth_aot() in tbforth.c). Don't edit.\n*/\n",
+	  dict_here());
+  fprintf(fp, aot_prologue, DICT_VERSION, NATIVE);
+  for (i = 0; i < aot_nwords; i++)
+    if (aot_native(&aot_words[i]))
+      fprintf(fp, "static tbforth_stat w_%u(void);\n", aot_words[i].xt);
+
+  for (i = 0; i < aot_nwords; i++) {
+    w = &aot_words[i];
+    if (!aot_native(w)) continue;
+    aot_ncalls = 0;
+    aot_analyse(w);		/* again, for aot_cell[] */
+    fprintf(fp, "\n/* ");
+    aot_name(fp, w->head);
+    fprintf(fp, " */\nstatic tbforth_stat w_%u(void) {\n  ENTER();\n", w->xt);
+    for (a = w->xt; a < w->end; a++) {
+      if (!(aot_cell[a] & AOT_START)) continue;
+      if (aot_cell[a] & AOT_TARGET) fprintf(fp, " L%u:\n", a);
+      aot_decode(a, &o);
+      aot_emit(fp, a, &o);
+    }
+    fprintf(fp, "}\n");
+    n++;
+  }
+
+  fprintf(fp, "\nconst struct tbforth_native tbforth_natives[] = {\n");
+  for (i = 0; i < aot_nwords; i++) {
+    w = &aot_words[i];
+    if (aot_native(w))
+      fprintf(fp, "  { %u, %u, %u, 0x%08xu, w_%u },\n", w->xt, w->end,
+	      tbforth_dict[w->xt], native_sum(w->xt + 1, w->end), w->xt);
+  }
+  if (n == 0) fprintf(fp, "  { 0, 0, 0, 0, 0 }\n");
+  fprintf(fp, "};\nconst uint16_t tbforth_nnatives = %u;\n", n);
+  return n;
+}
+#endif
+
+#ifdef TBFORTH_JIT
+/*
+  The JIT: a colon definition exec() has called jit_threshold times is
+  compiled to x86-64 machine code, if aot_build() finds it could be
+  native, and installed in natives->jit. The code does what tbforth-aot's C
+  does, on the stacks in uram, with sp in rbx, rp in r12, ds in r13, the
+  dictionary in r14, RAM in r15 and the return stack index on entry in
+  ebp. Each word has an inner entry (natives->entry[]) taking and leaving
+  those registers (when it returns 0, else the stacks are in uram), and
+  fn, which loads them, calls it and spills them. Compiled words call
+  each other's inner entry, anything else through jit_call_word(); what
+  isn't open coded runs in exec(). Code is never freed: a word written
+  into goes back to being interpreted (see native_forget()), and may be
+  compiled again.
+*/
+#include <stddef.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+#define JIT_CODE_BYTES (1 << 20)
+#define JIT_CELL_BYTES 160		/* most code one cell can take */
+#define JIT_MIN_OPS 6			/* instructions, in a word without loops */
+#define JIT_MAX_DEPTH 4			/* callees compiled with a word */
+
+enum { RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI, R12 = 12, R13, R14, R15 };
+enum { CC_AE = 3, CC_E, CC_NE, CC_NS = 9, CC_L = 12, CC_GE, CC_LE, CC_G };
+
+static uint8_t *jp;			/* where we write (in natives->code) */
+static CELL jit_xt;			/* word being compiled */
+static uint8_t *jit_at[MAX_DICT_CELLS];	/* code of each instruction (by a-xt) */
+static struct { uint8_t *at; CELL target; } jit_fix[MAX_DICT_CELLS];
+static int jit_nfix;			/* forward jumps */
+static uint8_t *jit_ret, *jit_out;	/* inner exits: return 0, return eax */
+
+static void x1(uint8_t b) { *jp++ = b; }
+static void x4(uint32_t v) { memcpy(jp, &v, 4); jp += 4; }
+
+/* REX prefix (w: 64 bit operands) for reg, index and base/rm, if needed */
+static void xrex(int w, int reg, int index, int rm) {
+  uint8_t rex = 0x40 | w << 3 | (reg & 8) >> 1 | (index & 8) >> 2 | (rm & 8) >> 3;
+  if (rex != 0x40) x1(rex);
+}
+
+static void xop(int op) {
+  if (op > 0xFF) x1(op >> 8);		/* 0x0Fxx */
+  x1(op);
+}
+
+/* op reg, [base + (index << scale) + disp] (index -1: none) */
+static void xmemx(int w, int op, int reg, int base, int index, int scale,
+		  int32_t disp) {
+  bool sib = index >= 0 || (base & 7) == RSP;
+  bool d8 = disp == (int8_t)disp;
+
+  xrex(w, reg, index >= 0 ? index : 0, base);
+  xop(op);
+  x1((d8 ? 0x40 : 0x80) | (reg & 7) << 3 | (sib ? 4 : base & 7));
+  if (sib) x1(scale << 6 | (index >= 0 ? index & 7 : 4) << 3 | (base & 7));
+  if (d8) x1(disp); else x4(disp);
+}
+#define xmem(w, op, reg, base, disp) xmemx(w, op, reg, base, -1, 0, disp)
+
+/* op reg, rm (registers) */
+static void xreg(int w, int op, int reg, int rm) {
+  xrex(w, reg, 0, rm);
+  xop(op);
+  x1(0xC0 | (reg & 7) << 3 | (rm & 7));
+}
+
+static void xmovi(int r, uint64_t v) {	/* mov r64, imm64 */
+  xrex(1, 0, 0, r);
+  x1(0xB8 | (r & 7));
+  x4(v);
+  x4(v >> 32);
+}
+
+static void xpatch(uint8_t *at, uint8_t *to) {
+  int32_t rel = to - (at + 4);
+  memcpy(at, &rel, 4);
+}
+
+/* jmp (cc -1) or jcc to to. Returns the rel32, for xpatch() if to is 0. */
+static uint8_t *xjmp(int cc, uint8_t *to) {
+  uint8_t *at;
+  if (cc < 0) {
+    x1(0xE9);
+  } else {
+    x1(0x0F);
+    x1(0x80 | cc);
+  }
+  at = jp;
+  x4(0);
+  if (to) xpatch(at, to);
+  return at;
+}
+
+#define X_LD(r, b, d) xmem(0, 0x8B, r, b, d)	/* mov r32, [b+d] */
+#define X_ST(r, b, d) xmem(0, 0x89, r, b, d)	/* mov [b+d], r32 */
+#define X_ADDI(r, i) (xreg(1, 0x83, 0, r), x1(i)) /* add r64, imm8 */
+#define X_SUBI(r, i) (xreg(1, 0x83, 5, r), x1(i))
+#define X_OPI(ext, b, d, i) (xmem(0, 0x81, ext, b, d), x4(i)) /* dword [b+d], imm32 */
+#define X_TEST_EAX() xreg(0, 0x85, RAX, RAX)
+
+static void jit_ccall(uintptr_t fn) {	/* call fn (arguments in edi, esi) */
+  xmovi(RAX, fn);
+  xreg(0, 0xFF, 2, RAX);
+}
+
+/* r = (r - ds) / 4: a stack index */
+static void jit_index(int r, int from, bool sign) {
+  xreg(1, 0x89, from, r);
+  xreg(1, 0x2B, r, R13);
+  xreg(1, 0xC1, sign ? 7 : 5, r);
+  x1(2);
+}
+
+/* SPILL() and FILL(), using rax and rcx */
+static void jit_spill(void) {
+  xmovi(RAX, (uintptr_t)&tbforth_uram);
+  xmem(1, 0x8B, RAX, RAX, 0);
+  jit_index(RCX, RBX, 1);
+  X_ST(RCX, RAX, offsetof(struct tbforth_uram, didx));
+  jit_index(RCX, R12, 0);
+  X_ST(RCX, RAX, offsetof(struct tbforth_uram, ridx));
+}
+
+static void jit_fill(void) {
+  xmovi(RAX, (uintptr_t)&tbforth_uram);
+  xmem(1, 0x8B, RAX, RAX, 0);
+  xmem(1, 0x8D, R13, RAX, offsetof(struct tbforth_uram, ds));
+  xmem(1, 0x63, RCX, RAX, offsetof(struct tbforth_uram, didx)); /* movsxd */
+  xmemx(1, 0x8D, RBX, R13, RCX, 2, 0);
+  X_LD(RCX, RAX, offsetof(struct tbforth_uram, ridx));
+  xmemx(1, 0x8D, R12, R13, RCX, 2, 0);
+}
+
+/* Run the primitive's word px in exec() */
+static void jit_prim(CELL px) {
+  jit_spill();
+  x1(0xB8 | RDI);			/* mov edi, px */
+  x4(px);
+  jit_ccall((uintptr_t)tbforth_native_prim);
+  X_TEST_EAX();
+  xjmp(CC_NE, jit_out);
+  jit_fill();
+}
+
+static tbforth_stat jit_call_word(CELL xt) {
+  return tbforth_dict[xt] == NATIVE ? native_call(xt) : tbforth_native_exec(xt);
+}
+
+/*
+  CALL_() of tbforth-aot's prologue, or straight into xt's inner entry
+  while it has one. [rsp] holds r_.
+*/
+static void jit_call(CELL xt, CELL ret) {
+  uint8_t *slow, *odd1, *odd2, *done, *back;
+
+  xmovi(RAX, (uintptr_t)&natives->entry[xt]);
+  xmem(1, 0x8B, RAX, RAX, 0);
+  xreg(1, 0x85, RAX, RAX);
+  slow = xjmp(CC_E, 0);
+  X_SUBI(R12, 4);
+  xmem(0, 0xC7, 0, R12, 0);
+  x4(ret);
+  xreg(0, 0xFF, 2, RAX);		/* call rax */
+  X_TEST_EAX();
+  xjmp(CC_NE, jit_out);
+  X_ADDI(R12, 4);			/* it can't have moved it (aot_analyse()) */
+  back = xjmp(-1, 0);
+
+  xpatch(slow, jp);
+  jit_index(RAX, R12, 0);
+  X_ST(RAX, RSP, 0);
+  X_SUBI(R12, 4);
+  xmem(0, 0xC7, 0, R12, 0);		/* mov dword [r12], ret */
+  x4(ret);
+  jit_spill();
+  x1(0xB8 | RDI);
+  x4(xt);
+  jit_ccall((uintptr_t)jit_call_word);
+  X_TEST_EAX();
+  xjmp(CC_NE, jit_out);
+  jit_fill();
+  jit_index(RAX, R12, 0);		/* came back as it should? */
+  X_LD(RCX, RSP, 0);
+  xreg(0, 0x83, 5, RCX);
+  x1(1);
+  xreg(0, 0x39, RCX, RAX);
+  odd1 = xjmp(CC_NE, 0);
+  X_OPI(7, R12, 0, ret);
+  odd2 = xjmp(CC_NE, 0);
+  X_ADDI(R12, 4);
+  done = xjmp(-1, 0);
+  xpatch(odd1, jp);
+  xpatch(odd2, jp);
+  xreg(0, 0x89, RBP, RDI);
+  X_LD(RSI, RSP, 0);
+  jit_ccall((uintptr_t)tbforth_native_return);
+  X_TEST_EAX();
+  xjmp(CC_NE, jit_out);
+  jit_fill();				/* done, interpreted */
+  xjmp(-1, jit_ret);
+  xpatch(done, jp);
+  xpatch(back, jp);
+}
+
+/*
+  Is RAM cell edx in uram's header (didx, ridx...)? Returns the jump
+  taken if not. The stacks themselves are always up to date in RAM.
+*/
+static uint8_t *jit_in_header(void) {
+  xmemx(1, 0x8D, RAX, R15, RDX, 2, 0);
+  xmem(1, 0x8D, RCX, R13, -(int)offsetof(struct tbforth_uram, ds));
+  xreg(1, 0x2B, RAX, RCX);
+  xreg(1, 0x83, 7, RAX);
+  x1(offsetof(struct tbforth_uram, ds));
+  return xjmp(CC_AE, 0);
+}
+
+/* FETCH() of tbforth-aot's prologue */
+static void jit_fetch(void) {
+  uint8_t *in_dict, *done, *plain, *skip;
+
+  X_LD(RDX, RBX, 0);
+  xreg(0, 0x0FBA, 6, RDX);		/* btr edx, 31 */
+  x1(31);
+  in_dict = xjmp(CC_AE, 0);
+  skip = jit_in_header();
+  X_SUBI(RBX, 4);
+  jit_spill();
+  X_ADDI(RBX, 4);
+  xpatch(skip, jp);
+  xmemx(0, 0x8B, RAX, R15, RDX, 2, 0);
+  done = xjmp(-1, 0);
+  xpatch(in_dict, jp);
+  xmemx(0, 0x0FB7, RAX, R14, RDX, 1, 0); /* movzx eax, word */
+  x1(0x3D);				/* cmp eax, NATIVE */
+  x4(NATIVE);
+  plain = xjmp(CC_NE, 0);
+  xreg(0, 0x89, RDX, RDI);
+  jit_ccall((uintptr_t)tbforth_native_first);
+  xreg(0, 0x0FB7, RAX, RAX);
+  xpatch(done, jp);
+  xpatch(plain, jp);
+  X_ST(RAX, RBX, 0);
+}
+
+/* STORE() of tbforth-aot's prologue */
+static void jit_store(CELL px) {
+#ifdef GUARD_RAILS
+  jit_prim(px);
+#else
+  uint8_t *in_dict, *done, *done2, *skip;
+
+  X_LD(RDX, RBX, 0);
+  xreg(0, 0x0FBA, 6, RDX);
+  x1(31);
+  in_dict = xjmp(CC_AE, 0);
+  X_SUBI(RBX, 8);
+  skip = jit_in_header();
+  jit_spill();
+  X_LD(RCX, RBX, 4);
+  xmemx(0, 0x89, RCX, R15, RDX, 2, 0);
+  jit_fill();
+  done = xjmp(-1, 0);
+  xpatch(skip, jp);
+  X_LD(RCX, RBX, 4);
+  xmemx(0, 0x89, RCX, R15, RDX, 2, 0);
+  done2 = xjmp(-1, 0);
+  xpatch(in_dict, jp);
+  jit_prim(px);
+  xpatch(done, jp);
+  xpatch(done2, jp);
+#endif
+}
+
+/* setcc: -1 or 0 to [rbx+d] */
+static void jit_flag(int cc, int32_t d) {
+  xreg(0, 0x0F90 | cc, 0, RAX);
+  xreg(0, 0x0FB6, RAX, RAX);
+  xreg(0, 0xF7, 3, RAX);
+  X_ST(RAX, RBX, d);
+}
+
+static void jit_jump(CELL a, int cc, CELL target) {
+  if (target <= a) {
+    xjmp(cc, jit_at[target - jit_xt]);
+  } else {
+    jit_fix[jit_nfix].at = xjmp(cc, 0);
+    jit_fix[jit_nfix++].target = target;
+  }
+}
+
+/* The instruction o at a (as aot_emit() does it in C) */
+static void jit_emit(CELL a, struct aot_op *o) {
+  static const uint8_t alu[LAST_PRIMITIVE] = {
+    [ADD] = 0x01, [SUB] = 0x29, [AND] = 0x21, [OR] = 0x09, [XOR] = 0x31
+  };
+  static const uint8_t cmp[LAST_PRIMITIVE] = {
+    [LESS_THAN] = CC_L, [GREATER_THAN] = CC_G, [GREATER_THAN_EQ] = CC_GE,
+    [EQ] = CC_E
+  };
+
+  switch (o->kind) {
+  case K_LIT:
+    X_ADDI(RBX, 4);
+    xmem(0, 0xC7, 0, RBX, 0);
+    x4(o->val);
+    return;
+  case K_EXIT:
+    xjmp(-1, jit_ret);
+    return;
+  case K_BRANCH:
+    jit_jump(a, -1, o->target);
+    return;
+  case K_ZBRANCH:
+    X_LD(RAX, RBX, 0);
+    X_SUBI(RBX, 4);
+    X_TEST_EAX();
+    jit_jump(a, CC_E, o->target);
+    return;
+  case K_LOOP:
+    if (o->op == RLOOP) {
+      X_OPI(5, R12, 0, 1);
+      jit_jump(a, CC_NS, o->target);
+      return;
+    }
+    if (o->op == LOOP1) {
+      X_OPI(0, R12, 0, 1);
+    } else {
+      X_LD(RAX, RBX, 0);
+      X_SUBI(RBX, 4);
+      xmem(0, 0x01, RAX, R12, 0);
+    }
+    X_LD(RAX, R12, 0);
+    xmem(0, 0x3B, RAX, R12, 4);
+    jit_jump(a, CC_L, o->target);
+    return;
+  case K_CALL:
+    jit_call(o->target, a + o->len);
+    return;
+  }
+
+  if (alu[o->op]) {
+    X_LD(RAX, RBX, 0);
+    X_SUBI(RBX, 4);
+    xmem(0, alu[o->op], RAX, RBX, 0);
+    return;
+  }
+  if (cmp[o->op]) {
+    X_LD(RAX, RBX, 0);
+    X_SUBI(RBX, 4);
+    xmem(0, 0x39, RAX, RBX, 0);
+    jit_flag(cmp[o->op], 0);
+    return;
+  }
+  switch (o->op) {
+  case DROP: X_SUBI(RBX, 4); break;
+  case DUP:
+    X_LD(RAX, RBX, 0);
+    X_ST(RAX, RBX, 4);
+    X_ADDI(RBX, 4);
+    break;
+  case SWAP:
+    X_LD(RAX, RBX, 0);
+    X_LD(RCX, RBX, -4);
+    X_ST(RCX, RBX, 0);
+    X_ST(RAX, RBX, -4);
+    break;
+  case OVER:
+    X_LD(RAX, RBX, -4);
+    X_ST(RAX, RBX, 4);
+    X_ADDI(RBX, 4);
+    break;
+  case ROT:
+    X_LD(RAX, RBX, -8);
+    X_LD(RCX, RBX, 0);
+    X_ST(RCX, RBX, -8);
+    X_ST(RAX, RBX, 0);
+    break;
+  case INCR: case ONE_ADD: X_OPI(0, RBX, 0, 1); break;
+  case DECR: case ONE_SUB: X_OPI(5, RBX, 0, 1); break;
+  case MULT:
+    X_LD(RAX, RBX, -4);
+    xmem(0, 0x0FAF, RAX, RBX, 0);
+    X_SUBI(RBX, 4);
+    X_ST(RAX, RBX, 0);
+    break;
+  case DIV: case MOD:
+    X_LD(RAX, RBX, -4);
+    xreg(0, 0x31, RDX, RDX);
+    xmem(0, 0xF7, 6, RBX, 0);
+    X_SUBI(RBX, 4);
+    X_ST(o->op == DIV ? RAX : RDX, RBX, 0);
+    break;
+  case MULT_DIV:
+    X_LD(RAX, RBX, -8);
+    xmem(0, 0x0FAF, RAX, RBX, -4);
+    xreg(0, 0x31, RDX, RDX);
+    xmem(0, 0xF7, 6, RBX, 0);
+    X_SUBI(RBX, 8);
+    X_ST(RAX, RBX, 0);
+    break;
+  case LSHIFT: case RSHIFT:
+    X_LD(RCX, RBX, 0);
+    X_SUBI(RBX, 4);
+    xmem(0, 0xD3, o->op == LSHIFT ? 4 : 5, RBX, 0);
+    break;
+  case INVERT: xmem(0, 0xF7, 2, RBX, 0); break;
+  case EQ_ZERO: X_OPI(7, RBX, 0, 0); jit_flag(CC_E, 0); break;
+  case GT_ZERO: X_OPI(7, RBX, 0, 0); jit_flag(CC_G, 0); break;
+  case LT_ZERO: X_OPI(7, RBX, 0, 0); jit_flag(CC_L, 0); break;
+  case RTOP:
+    X_LD(RAX, R12, 0);
+    X_ST(RAX, RBX, 4);
+    X_ADDI(RBX, 4);
+    break;
+  case RPICK:
+    X_LD(RAX, RBX, 0);
+    xmemx(0, 0x8B, RAX, R12, RAX, 2, 0);
+    X_ST(RAX, RBX, 0);
+    break;
+  case RPUSH:
+    X_LD(RAX, RBX, 0);
+    X_SUBI(RBX, 4);
+    X_SUBI(R12, 4);
+    X_ST(RAX, R12, 0);
+    break;
+  case RPOP:
+    X_LD(RAX, R12, 0);
+    X_ADDI(R12, 4);
+    X_ADDI(RBX, 4);
+    X_ST(RAX, RBX, 0);
+    break;
+  case RDROP: X_ADDI(R12, 4); break;
+  case FETCH: jit_fetch(); break;
+  case FETCH_ADD:
+    jit_fetch();
+    X_LD(RAX, RBX, 0);
+    X_SUBI(RBX, 4);
+    xmem(0, 0x01, RAX, RBX, 0);
+    break;
+  case STORE: jit_store(aot_prim[STORE]); break;
+  case LIT_ADD: case DLIT_ADD: X_OPI(0, RBX, 0, o->val); break;
+  case LIT_SUB: case DLIT_SUB: X_OPI(5, RBX, 0, o->val); break;
+  case LIT_AND: X_OPI(4, RBX, 0, o->val); break;
+  case LIT_EQ: X_OPI(7, RBX, 0, o->val); jit_flag(CC_E, 0); break;
+  case LIT_RPICK:
+    X_LD(RAX, R12, o->val * 4);
+    X_ST(RAX, RBX, 4);
+    X_ADDI(RBX, 4);
+    break;
+  case DUP_EQ_ZERO:
+    X_OPI(7, RBX, 0, 0);
+    jit_flag(CC_E, 4);
+    X_ADDI(RBX, 4);
+    break;
+  case OVER_ADD:
+    X_LD(RAX, RBX, -4);
+    xmem(0, 0x01, RAX, RBX, 0);
+    break;
+  default:
+    jit_prim(aot_prim[o->op]);
+  }
+}
+
+static void jit_install(struct aot_word *w, uint8_t *fn, uint8_t *entry,
+			bool native) {
+  struct tbforth_native *e;
+  uint16_t i, j;
+
+  for (i = j = 0; i < natives->njit; i++) {	/* forgotten, where w is now */
+    if (natives->jit[i].end <= w->xt || natives->jit[i].xt >= w->end)
+      natives->jit[j++] = natives->jit[i];
+    else
+      natives->entry[natives->jit[i].xt] = 0;
+  }
+  natives->njit = j;
+  for (i = natives->njit++; i > 0 && natives->jit[i-1].xt > w->xt; i--)
+    natives->jit[i] = natives->jit[i-1];
+  e = &natives->jit[i];
+  e->xt = w->xt;
+  e->end = w->end;
+  e->first = tbforth_dict[w->xt];
+  e->sum = native_sum(w->xt + 1, w->end);
+  e->fn = (tbforth_stat (*)(void))fn;
+  natives->entry[w->xt] = entry;
+  if (native) DICT_WRITE(w->xt, NATIVE);
+  if (natives->hi == 0 || w->xt < natives->lo) natives->lo = w->xt;
+  if (w->end > natives->hi) natives->hi = w->end;
+  memset(natives->cache, 0, sizeof(natives->cache));
+}
+
+/*
+  Compile w, and what it calls (depth permitting). Getting in from exec()
+  and running a primitive in exec() each cost about what a dozen open
+  coded instructions save: words that are mostly primitives are left to
+  the interpreter, and those too short to gain are only called from
+  compiled code (they aren't installed as native).
+*/
+static void jit_word(struct aot_word *w, int depth) {
+  static const int saved[] = { RBX, RBP, R12, R13, R14, R15 };
+  struct aot_word *c;
+  struct aot_op o;
+  uint8_t *fn, *entry, *out;
+  CELL a, xt = w->xt;
+  int i, n, prims;
+  bool loops, native;
+
+  if (!aot_native(w) || tbforth_dict[xt] == NATIVE || natives->entry[xt] ||
+      natives->njit == JIT_MAX_WORDS)
+    return;
+  aot_ncalls = 0;
+  aot_analyse(w);			/* as it is now, for aot_cell[] */
+  if (!aot_native(w) ||
+      natives->code + JIT_CODE_BYTES - jp < (w->end - xt) * JIT_CELL_BYTES + 256)
+    return;
+  for (a = xt, n = prims = 0, loops = 0; a < w->end; a++) {
+    if (!(aot_cell[a] & AOT_START)) continue;
+    aot_decode(a, &o);
+    n++;
+    if (o.kind == K_OP && !aot_open_coded(o.op) && o.op != STORE) prims++;
+    if (o.kind == K_LOOP ||
+	((o.kind == K_BRANCH || o.kind == K_ZBRANCH) && o.target <= a))
+      loops = 1;
+  }
+  native = prims * 8 <= n && (loops || n >= JIT_MIN_OPS);
+  if (!native && prims > 1) return;
+
+  jit_xt = xt;
+  jit_nfix = 0;
+  jit_ret = jp;				/* inner exits first */
+  xreg(0, 0x31, RAX, RAX);
+  jit_out = jp;
+  X_ADDI(RSP, 16);
+  x1(0x58 | RBP);
+  x1(0xC3);
+
+  entry = jp;				/* [rsp]: r_ (see jit_call()) */
+  x1(0x50 | RBP);
+  X_SUBI(RSP, 16);
+  jit_index(RBP, R12, 0);
+  for (a = xt; a < w->end; a++) {
+    if (!(aot_cell[a] & AOT_START)) continue;
+    jit_at[a - xt] = jp;
+    aot_decode(a, &o);
+    jit_emit(a, &o);
+  }
+  for (i = 0; i < jit_nfix; i++)
+    xpatch(jit_fix[i].at, jit_at[jit_fix[i].target - xt]);
+
+  fn = jp;
+  for (i = 0; i < 6; i++) {		/* push, and keep rsp 16 byte aligned */
+    xrex(0, 0, 0, saved[i]);
+    x1(0x50 | (saved[i] & 7));
+  }
+  X_SUBI(RSP, 8);
+  xmovi(RAX, (uintptr_t)&tbforth_dict);
+  xmem(1, 0x8B, R14, RAX, 0);
+  xmovi(RAX, (uintptr_t)&tbforth_ram);
+  xmem(1, 0x8B, R15, RAX, 0);
+  jit_fill();
+  x1(0xE8);				/* call entry */
+  xpatch(jp, entry);
+  jp += 4;
+  X_TEST_EAX();
+  out = xjmp(CC_NE, 0);
+  jit_spill();
+  xreg(0, 0x31, RAX, RAX);
+  xpatch(out, jp);
+  X_ADDI(RSP, 8);
+  for (i = 5; i >= 0; i--) {
+    xrex(0, 0, 0, saved[i]);
+    x1(0x58 | (saved[i] & 7));
+  }
+  x1(0xC3);
+  jit_install(w, fn, entry, native);
+
+  if (depth == JIT_MAX_DEPTH) return;
+  for (a = xt; a < w->end; a++) {
+    if (!(aot_cell[a] & AOT_START)) continue;
+    aot_decode(a, &o);
+    if (o.kind == K_CALL && (c = aot_word_at(o.target)) != 0)
+      jit_word(c, depth + 1);
+  }
+}
+
+/*
+  The code buffer is never writable and executable at once: the pages
+  from jp on are made writable while compiling, then executable again.
+*/
+static bool jit_protect(uint8_t *from, int prot) {
+  return mprotect(from, natives->code + JIT_CODE_BYTES - from, prot) == 0;
+}
+
+/* xt got hot (see JIT_CALL()): compile it, if it can be */
+static void jit_compile(CELL xt) {
+  struct aot_word *w;
+  uint8_t *from;
+
+  if (jit_threshold == 0 || xt >= dict_here()) return;
+  if (natives->code == 0) {
+    natives->code = mmap(0, JIT_CODE_BYTES, PROT_READ | PROT_WRITE,
+			 MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (natives->code == MAP_FAILED) {
+      natives->code = 0;
+      jit_threshold = 0;
+      return;
+    }
+    natives->codep = natives->code;
+  }
+  if (jit_built_dict != dict || jit_built_here != dict_here() ||
+      jit_built_last != dict->last_word_idx) {
+    aot_build();
+    jit_built_dict = dict;
+    jit_built_here = dict_here();
+    jit_built_last = dict->last_word_idx;
+  }
+  if ((w = aot_word_at(xt)) == 0) return;
+  jp = natives->codep;
+  from = natives->code + ((jp - natives->code) & ~(sysconf(_SC_PAGESIZE) - 1));
+  if (!jit_protect(from, PROT_READ | PROT_WRITE)) {
+    jit_threshold = 0;
+    return;
+  }
+  jit_word(w, 0);
+  natives->codep = jp;
+  if (!jit_protect(from, PROT_READ | PROT_EXEC)) abort();
+}
+
+/* Calls from now on before a word is compiled */
+void tbforth_jit_threshold(uint16_t calls) {
+  jit_threshold = calls;
+  memset(natives->calls, 0, sizeof(natives->calls));
+}
+#endif
+#endif
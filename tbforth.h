@@ -8,7 +8,7 @@
 /* Configuration */
 
 #define TBFORTH_VERSION "4.08"
-#define DICT_VERSION 22
+#define DICT_VERSION 32
 
 // Some (minimal) memory protection for ! and dict_write()
 //
@@ -36,6 +36,27 @@
 #define DS_CELLS 		50
 #define RS_CELLS 		50
 
+/*
+ Hash index (in RAM) over word names for faster lookups. Each slot is one
+ CELL and it holds up to 3/4 of that many words (beyond that we fall back
+ to searching the dictionary list). Must be a power of 2.
+ Define NO_DICT_HASH to leave it out and save the RAM on tiny MCUs.
+*/
+// #define NO_DICT_HASH
+#ifdef NO_DICT_HASH
+#undef DICT_HASH_SLOTS
+#elif !defined(DICT_HASH_SLOTS)
+#define DICT_HASH_SLOTS		(1024)
+#endif
+
+/*
+ Task table size for the scheduler (spawn, yield, etc). Task 0 is the
+ interpreter itself. Must be a power of 2 (and at most 128).
+*/
+#ifndef MAX_TASKS
+#define MAX_TASKS		(16)
+#endif
+
 /*
  Input buffer... longest line you can give tbforth to interpret.
 */
@@ -52,6 +73,82 @@
 //
 #define SUPPORT_FLOAT_FIXED
 
+// Let the compiler fuse common opcode sequences (for/next, do/loop, if,
+// lit +, etc) into single "superinstructions".
+//
+#define FUSE_SUPERINSTRUCTIONS
+
+// "inline" marks the last word so that calls of it compile to a copy of
+// its body instead (2dup, nip...). Defining INLINE_MAX_CELLS does that
+// for every colon definition of at most that many cells of straight line
+// code, at the cost of dictionary space; is/to no longer reach the
+// copies.
+//
+#ifndef INLINE_MAX_CELLS
+#define INLINE_MAX_CELLS	(0)
+#endif
+
+// The inner interpreter (exec) keeps the top of the data stack and both
+// stack pointers in locals, and only writes them back to uram when
+// something else may look at the stacks (cf, interpret, uram!, @ and ! on
+// uram). Define NO_TOS_CACHE to always go through tbforth_uram.
+//
+// #define NO_TOS_CACHE
+#if defined(__GNUC__) && !defined(NO_TOS_CACHE)
+#define TOS_CACHE
+#endif
+
+// The inner interpreter (exec) uses GCC/Clang "labels as values" to thread
+// from one opcode to the next when it can. Define NO_THREADED_DISPATCH to
+// force the portable switch() interpreter.
+//
+// #define NO_THREADED_DISPATCH
+#if defined(__GNUC__) && !defined(NO_THREADED_DISPATCH)
+#define THREADED_DISPATCH
+#endif
+
+// Define TBFORTH_THREADS (C11) to make the current interpreter instance
+// (see struct tbforth_vm) thread local, so each thread can run its own.
+//
+// #define TBFORTH_THREADS
+#ifdef TBFORTH_THREADS
+#define TBFORTH_TLS _Thread_local
+#else
+#define TBFORTH_TLS
+#endif
+
+// Define TBFORTH_PROFILE to have exec() count calls and time (inclusive
+// and exclusive) per colon definition, for profile-report (see util.f).
+// Time comes from PROFILE_CLOCK_NS(), clock_gettime() unless the host
+// defines it. Hosts may also sample (see tbforth_profile_sample()).
+//
+// #define TBFORTH_PROFILE
+#ifndef PROFILE_SLOTS
+#define PROFILE_SLOTS		(1024) /* words profiled, a power of 2 */
+#endif
+
+// Define TBFORTH_OPSTATS to have exec() count each opcode it runs and each
+// adjacent pair, for .opstats (see util.f).
+//
+// #define TBFORTH_OPSTATS
+
+// Hosts built with tbforth.img.c (the colon definitions of tbforth.img
+// translated to C, see tbforth-aot.c) define TBFORTH_NATIVE and install
+// them (tbforth_native_install()) once the dictionary is in place.
+//
+// #define TBFORTH_NATIVE
+
+// Define TBFORTH_JIT (x86-64 hosts, without TBFORTH_THREADS) to have
+// exec() count calls to each colon definition and compile those called
+// JIT_THRESHOLD times to machine code, run as native words (see below).
+// tbforth_jit_threshold() sets it (counting calls from then on), 0 turns
+// it off.
+//
+// #define TBFORTH_JIT
+#ifndef JIT_THRESHOLD
+#define JIT_THRESHOLD		(100)
+#endif
+
 /*
  Note: A Dictionary CELL is 2 bytes.
 */
@@ -73,7 +170,7 @@ typedef enum { U_OK=0, COMPILING, E_NOT_A_WORD, E_NOT_A_NUM,
 typedef enum { NO_ABORT=0, ABORT_CTRL_C=1, ABORT_NAW=2,
 	       ABORT_ILLEGAL=3, ABORT_WORD=4 } abort_t;
 
-extern abort_t _tbforth_abort_request;
+extern TBFORTH_TLS abort_t _tbforth_abort_request;
 #define tbforth_abort_request(why) _tbforth_abort_request = why
 #define tbforth_aborting() (_tbforth_abort_request != NO_ABORT)
 #define tbforth_abort_reason() _tbforth_abort_request
@@ -81,14 +178,18 @@ extern abort_t _tbforth_abort_request;
 
 char* tbforth_count_str(CELL addr,CELL* new_addr);
 
-extern RAMC tbforth_ram[];
-extern struct dict  *dict;
+extern TBFORTH_TLS RAMC *tbforth_ram;
+extern TBFORTH_TLS struct dict  *dict;
 
 extern void tbforth_init(void);
 extern void tbforth_bootstrap(void);
 extern void tbforth_load_prims(void);
 extern void tbforth_abort(CELL idx);
 extern tbforth_stat tbforth_interpret(char*);
+extern tbforth_stat tbforth_interpret_src(char *src, RAMC len);
+/* What the interpreter is reading: a source (see above) or the TIB */
+extern TBFORTH_TLS char *tbforth_src;
+#define TBFORTH_TIB (tbforth_src ? tbforth_src : tbforth_iram->tib)
 extern tbforth_stat c_handle(void);
 extern void tbforth_cdef (char*, int);
 extern char* tbforth_next_word (void);
@@ -129,6 +230,31 @@ struct dict {
   CELL d[MAX_DICT_CELLS];	/* dictionary */
 };
 
+/*
+ Saved images (save-image): this header, then struct dict up to here,
+ starting at IMAGE_DATA_OFFSET so a host can mmap it in place.
+*/
+#define IMAGE_MAGIC 0x49424654		/* "TFBI" */
+#define IMAGE_DATA_OFFSET 4096
+#define IMAGE_DICT_BYTES(here) \
+  (sizeof(struct dict) - (MAX_DICT_CELLS - (here)) * sizeof(CELL))
+
+struct tbforth_image {
+  uint32_t magic;
+  uint16_t version;		/* DICT_VERSION */
+  uint8_t cell_size;		/* sizeof(CELL) */
+  uint8_t little_endian;
+  CELL here;
+  CELL last_word_idx;
+  CELL varidx;
+  CELL max_cells;
+  uint32_t size;		/* bytes of struct dict saved */
+  uint32_t checksum;		/* FNV-1a of them */
+};
+
+extern void tbforth_image_header(struct tbforth_image *img);
+extern bool tbforth_image_check(struct tbforth_image *img, struct dict *d);
+
 /*
  All dictionary writing/updating is captured here.
 */
@@ -145,9 +271,156 @@ struct dict {
 }
 # define dict_end_def()
 
-extern CELL *tbforth_dict;
-extern struct tbforth_iram *tbforth_iram;
-extern struct tbforth_uram *tbforth_uram;
+extern TBFORTH_TLS CELL *tbforth_dict;
+extern TBFORTH_TLS struct tbforth_iram *tbforth_iram;
+extern TBFORTH_TLS struct tbforth_uram *tbforth_uram;
+
+#ifdef DICT_HASH_SLOTS
+/* RAM hash index over word names (see find_word()) */
+struct dict_index {
+  bool valid;			/* slots reflect dictionary up to "last"? */
+  bool full;			/* too many words: use the list instead */
+  CELL last;			/* last_word_idx when we last synced */
+  CELL count;			/* used slots */
+  CELL slot[DICT_HASH_SLOTS];	/* word header indexes (0 = empty) */
+};
+#endif
+
+/*
+ The cooperative scheduler. Each task runs on its own uram (stacks and
+ all, see make-task in tasks.f); switching tasks just swaps tbforth_uram,
+ with the task's ip saved on its own return stack. The ready queue is a
+ ring of task numbers, sleeping tasks are kept in a heap by wake up time.
+ Tasks WAITING on a file descriptor are handed to the host (OS_WAIT_FD),
+ which calls tbforth_wake() when the fd is ready.
+*/
+enum { TASK_FREE=0, TASK_READY, TASK_RUNNING, TASK_SUSPENDED, TASK_SLEEPING,
+       TASK_WAITING };
+
+struct tbforth_sched {
+  RAMC uram[MAX_TASKS];		/* task's uram (as a RAM cell index) */
+  uint8_t state[MAX_TASKS];
+  uint8_t ready[MAX_TASKS];	/* READY tasks, in run order */
+  uint8_t head;			/* first in ready */
+  uint8_t count;		/* number in ready */
+  uint8_t current;		/* running task */
+  RAMC wake[MAX_TASKS];		/* when (ms) a sleeping task wakes up (or fd) */
+  uint8_t sleeping[MAX_TASKS];	/* heap of sleeping tasks, soonest first */
+  uint8_t nsleep;		/* number in sleeping */
+  uint8_t nwait;		/* number WAITING on an fd */
+  uint8_t events;		/* what the current task waits for (see (wait-fd)) */
+  uint8_t ticks;		/* switches since we last polled the fds */
+};
+
+/*
+ Snapshots (save-snapshot): an image plus all of RAM (at SNAPSHOT_RAM_OFFSET)
+ and the scheduler, so a host can carry on where it left off (see
+ tbforth_snapshot_restore()).
+*/
+#define SNAPSHOT_MAGIC 0x53424654	/* "TFBS" */
+#define SNAPSHOT_RAM_OFFSET \
+  (IMAGE_DATA_OFFSET + ((sizeof(struct dict) + 4095) & ~4095))
+#define SNAPSHOT_RAM_BYTES (TOTAL_RAM_CELLS * sizeof(RAMC))
+
+struct tbforth_snapshot {
+  struct tbforth_image img;	/* img.magic is SNAPSHOT_MAGIC */
+  uint32_t ram_cells;		/* TOTAL_RAM_CELLS */
+  uint32_t ram_checksum;
+  RAMC ms;			/* when it was taken */
+  struct tbforth_sched sched;
+};
+
+extern void tbforth_snapshot_header(struct tbforth_snapshot *s);
+extern bool tbforth_snapshot_check(struct tbforth_snapshot *s, struct dict *d, RAMC *ram);
+extern void tbforth_snapshot_restore(struct tbforth_snapshot *s);
+
+/*
+ Native code: colon definitions translated to C ahead of time by
+ tbforth-aot (one function per word, see tbforth_aot()), or to machine
+ code by the JIT (TBFORTH_JIT). Installing the table puts the NATIVE
+ opcode in the first cell of each word whose code is still what was
+ translated, and exec() calls the function instead. A word written into
+ (!, is, to, c!, bcopy, forget...) is interpreted again. Take them out
+ (tbforth_native_remove(), JIT words too) before saving the dictionary.
+*/
+struct tbforth_native {
+  CELL xt, end;			/* the code translated: [xt,end) */
+  CELL first;			/* what was at xt */
+  uint32_t sum;			/* of the cells after xt (see native_sum()) */
+  tbforth_stat (*fn)(void);
+};
+
+/* An instance's native words: the installed table, then the JIT's */
+#define NATIVE_CACHE 64			/* a power of 2 */
+#ifdef TBFORTH_JIT
+#define JIT_MAX_WORDS 1024
+#endif
+struct tbforth_natives {
+  const struct tbforth_native *tab;	/* sorted by xt */
+  uint16_t n;
+  CELL lo, hi;				/* [xt,end) of all installed */
+  const struct tbforth_native *cache[NATIVE_CACHE];
+#ifdef TBFORTH_JIT
+  struct tbforth_native jit[JIT_MAX_WORDS]; /* sorted by xt */
+  uint16_t njit;
+  uint8_t *entry[0x10000];		/* where compiled code calls it */
+  uint16_t calls[0x10000];		/* by xt */
+  uint8_t *code, *codep;		/* code buffer, where it's at */
+#endif
+};
+
+/*
+ An interpreter instance. The interpreter always runs the "current" one
+ through the globals above (dict, tbforth_ram, tbforth_uram, ...).
+ tbforth_vm_select() saves them into the current instance and loads
+ another; the fields are only up to date while an instance isn't current.
+ Never switch from inside exec() (e.g. from c_handle()).
+*/
+struct tbforth_vm {
+  struct dict *dict;
+  RAMC *ram;			/* TOTAL_RAM_CELLS */
+  struct tbforth_uram *uram;	/* current uram (task) */
+  abort_t abort_request;
+  char *a_reg, *b_reg;
+  tbforth_stat (*c_handle)(struct tbforth_vm*); /* 0 = use c_handle() */
+  void *host;			/* host's per instance data */
+  struct tbforth_sched sched;
+#ifdef DICT_HASH_SLOTS
+  struct dict_index index;
+#endif
+  struct tbforth_natives natives;
+};
+
+extern TBFORTH_TLS struct tbforth_vm *tbforth_cur_vm;
+extern void tbforth_vm_setup(struct tbforth_vm *vm, struct dict *d, RAMC *ram);
+extern struct tbforth_vm* tbforth_vm_select(struct tbforth_vm *vm);
+extern tbforth_stat tbforth_vm_interpret(struct tbforth_vm *vm, char *str);
+extern tbforth_stat tbforth_vm_exec(struct tbforth_vm *vm, CELL ip);
+extern RAMC tbforth_spawn(RAMC xt, RAMC uram);
+extern void tbforth_wake(RAMC task, RAMC fd);
+extern void tbforth_sched_reset(void);
+#ifdef TBFORTH_PROFILE
+extern void tbforth_profile_sample(void);
+extern void tbforth_profile_timing(bool on);
+#endif
+
+extern uint16_t tbforth_native_install(const struct tbforth_native *tab, uint16_t n);
+extern void tbforth_native_remove(void);
+/* For the generated code */
+extern tbforth_stat tbforth_native_exec(CELL xt);
+extern tbforth_stat tbforth_native_prim(CELL xt);
+extern tbforth_stat tbforth_native_return(RAMC rentry, RAMC rcall);
+extern CELL tbforth_native_first(CELL a);
+#ifdef TBFORTH_NATIVE
+extern const struct tbforth_native tbforth_natives[];
+extern const uint16_t tbforth_nnatives;
+#endif
+#ifdef TBFORTH_AOT
+extern uint16_t tbforth_aot(FILE *fp);
+#endif
+#ifdef TBFORTH_JIT
+extern void tbforth_jit_threshold(uint16_t calls);
+#endif
 /*
  Convenient short-cuts. data stack grows up, return stack grows down
 */
@@ -155,6 +428,7 @@ extern struct tbforth_uram *tbforth_uram;
 #define dpush(n) (tbforth_uram->ds[1+tbforth_uram->didx] = n, tbforth_uram->didx++)
 #define dpop() tbforth_uram->ds[tbforth_uram->didx--]
 #define dpick(n) tbforth_uram->ds[tbforth_uram->didx-n]
+#define dpush64(n) (dpush((RAMC)(n)), dpush((RAMC)((uint64_t)(n) >> 32))) /* low cell first */
 
 #define rpush(n) (tbforth_uram->ds[--tbforth_uram->ridx] = n)
 #define rpop() tbforth_uram->ds[tbforth_uram->ridx++]
@@ -170,16 +444,29 @@ extern void tbforth_cdef (char* name, int val);
 // If you don't have them, just ignore them.
 //
 enum { OS_EMIT=1, OS_KEY, OS_SAVE_IMAGE, OS_INCLUDE, OS_OPEN, OS_SEEK,OS_CLOSE, OS_DELETE,
-  OS_READB, OS_WRITEB, OS_READBUF, OS_WRITEBUF, OS_MS, OS_US, OS_SECS, OS_POLL, OS_TCP_CONN, OS_TCP_DISCONN, OS_RAND};
+  OS_READB, OS_WRITEB, OS_READBUF, OS_WRITEBUF, OS_MS, OS_US, OS_SECS, OS_POLL, OS_TCP_CONN, OS_TCP_DISCONN, OS_RAND,
+  OS_IDLE /* ( ms - ) all tasks sleep: wait (low power) up to ms (-1 forever) */,
+  OS_WAIT_FD /* ( task events fd - flag ) park task until fd is ready (events: 1 read, 2 write) */,
+  OS_FLUSH /* ( fd - ) write out anything buffered for fd (1 is the console) */,
+  OS_TYPE /* ( addr count - ) console output of count bytes at addr */,
+  OS_SAVE_SNAPSHOT, OS_LOAD_SNAPSHOT,
+  OS_PROFILE_SAMPLE /* ( us - ) sample the running word every us of CPU (0 stops) */,
+  OS_NS /* ( - lo hi ) monotonic ns as two cells */,
+  OS_CYCLES /* ( - lo hi ) CPU cycle counter as two cells */ };
 
 #define OS_WORDS() \
   tbforth_cdef("secs", OS_SECS); \
   tbforth_cdef("ms", OS_MS); \
   tbforth_cdef("us", OS_US); \
+  tbforth_cdef("ns@", OS_NS); \
+  tbforth_cdef("cycles@", OS_CYCLES); \
   tbforth_cdef("(emit)", OS_EMIT); \
   tbforth_cdef("poll", OS_POLL); \
   tbforth_cdef("(key)", OS_KEY); \
   tbforth_cdef("save-image", OS_SAVE_IMAGE); \
+  tbforth_cdef("save-snapshot", OS_SAVE_SNAPSHOT); \
+  tbforth_cdef("load-snapshot", OS_LOAD_SNAPSHOT); \
+  tbforth_cdef("profile-sample", OS_PROFILE_SAMPLE); \
   tbforth_cdef("include", OS_INCLUDE); \
   tbforth_cdef("open-file", OS_OPEN); \
   tbforth_cdef("seek", OS_SEEK); \
@@ -191,6 +478,8 @@ enum { OS_EMIT=1, OS_KEY, OS_SAVE_IMAGE, OS_INCLUDE, OS_OPEN, OS_SEEK,OS_CLOSE,
   tbforth_cdef("read-byte", OS_READB); \
   tbforth_cdef("write-buf", OS_WRITEBUF); \
   tbforth_cdef("read-buf", OS_READBUF); \
+  tbforth_cdef("flush-fd", OS_FLUSH); \
+  tbforth_cdef("(type)", OS_TYPE); \
   tbforth_cdef("random-bytes", OS_RAND);
 
   
@@ -0,0 +1,3 @@
+struct dict flashdict = {32,2,32767,4021,3872,260,{
+0x0,0x0,0x43,0x696C,0x74,0x1,0x7,0x44,0x6C64,0x7469,0x3,0xC,0x44,0x7264,0x706F,0x22,0x11,0x43,0x6F72,0x74,0x26,0x16,0x43,0x7564,0x70,0x23,0x1B,0x44,0x7773,0x7061,0x24,0x20,0x44,0x766F,0x7265,0x25,0x25,0x43,0x6D6A,0x70,0x16,0x2A,0x45,0x6A30,0x706D,0x3F,0x17,0x2F,0x46,0x7330,0x696B,0x3F70,0x18,0x35,0x41,0x2C,0x2E,0x3B,0x42,0x2C64,0x2F,0x3F,0x42,0x2B31,0xD,0x43,0x42,0x2D31,0xE,0x47,0x41,0x2B,0xF,0x4B,0x41,0x2D,0x10,0x4F,0x43,0x6E61,0x64,0x15,0x53,0x42,0x726F,0x1A,0x58,0x43,0x6F78,0x72,0x1B,0x5C,0x46,0x6E69,0x6576,0x7472,0x2D,0x61,0x46,0x736C,0x6968,0x7466,0x1C,0x67,0x46,0x7372,0x6968,0x7466,0x1D,0x6D,0x41,0x2A,0x11,0x73,0x41,0x2F,0x12,0x77,0x42,0x2F2A,0x13,0x7B,0x43,0x6F6D,0x64,0x14,0x7F,0x42,0x3D30,0x1E,0x84,0x42,0x3E30,0x1F,0x88,0x42,0x3C30,0x20,0x8C,0x41,0x3D,0x21,0x90,0x41,0x3C,0x2A,0x94,0x41,0x3E,0x2B,0x98,0x42,0x3D3E,0x2C,0x9C,0x42,0x4072,0x9,0xA0,0x45,0x7072,0x6369,0x6B,0xA,0xA4,0x42,0x723E,0x30,0xAA,0x42,0x3E72,0x31,0xAE,0x41,0x21,0x33,0xB2,0x41,0x40,0x32,0xB6,0x42,0x2141,0x35,0xBA,0x44,0x3C41,0x423E,0x36,0xBE,0x42,0x2B41,0x39,0xC3,0x44,0x6328,0x2940,0x37,0xC7,0x44,0x6328,0x2921,0x38,0xCC,0x45,0x6328,0x2B40,0x29,0x3A,0xD1,0x45,0x6328,0x2B21,0x29,0x3B,0xD7,0xC2,0x222C,0x34,0xDD,0x43,0x632B,0x21,0x40,0xE1,0x43,0x2163,0x2B,0x3F,0xE6,0x43,0x632B,0x40,0x41,0xEB,0x48,0x6328,0x6572,0x7461,0x2965,0x44,0xF0,0x49,0x656E,0x7478,0x772D,0x726F,0x64,0x27,0xF7,0x49,0x656E,0x7478,0x632D,0x6168,0x72,0x28,0xFF,0x41,0x3B,0x19,0x107,0x49,0x6D69,0x656D,0x6964,0x7461,0x65,0x6,0x10B,0x46,0x6E69,0x696C,0x656E,0x52,0x113,0x48,0x6128,0x6C6C,0x746F,0x2931,0x3C,0x119,0x46,0x6628,0x6E69,0x2964,0x3E,0x120,0x44,0x6F63,0x646C,0x2,0x126,0x45,0x6261,0x726F,0x74,0x4,0x12B,0x45,0x6362,0x706F,0x79,0x42,0x131,0x45,0x7362,0x7274,0x3D,0x43,0x137,0x47,0x733E,0x7274,0x6E69,0x67,0x69,0x13D,0x44,0x6E3E,0x6D75,0x45,0x144,0x48,0x3E75,0x7473,0x6972,0x676E,0x6A,0x149,0x44,0x7865,0x6365,0x29,0x150,0x44,0x7275,0x6D61,0x7,0x155,0x45,0x7275,0x6D61,0x21,0x8,0x15A,0x44,0x7269,0x6D61,0xC,0x160,0x49,0x6E69,0x6574,0x7072,0x6572,0x74,0x46,0x165,0x42,0x6663,0x3D,0x16D,0x44,0x6568,0x6572,0xB,0x171,0x45,0x7073,0x7761,0x6E,0x47,0x176,0x45,0x6979,0x6C65,0x64,0x48,0x17C,0x47,0x7573,0x7073,0x6E65,0x64,0x49,0x182,0x46,0x6572,0x7573,0x656D,0x4A,0x189,0x4A,0x7428,0x7361,0x2D6B,0x6E65,0x2964,0x4B,0x18F,0x47,0x6174,0x6B73,0x692D,0x64,0x4C,0x197,0x48,0x6C73,0x6565,0x2D70,0x736D,0x4D,0x19E,0x45,0x7461,0x6D2D,0x73,0x4E,0x1A5,0x49,0x7728,0x6961,0x2D74,0x6466,0x29,0x4F,0x1AB,0x49,0x7028,0x6F72,0x6966,0x656C,0x29,0x50,0x1B3,0x49,0x6F28,0x7370,0x6174,0x7374,0x29,0x51,0x1BB,0x1,0x3A,0x44,0x54,0xC,0x33,0xB,0x55,0xC,0xF,0x33,0x19,0x1C3,0x81,0x5C,0x28,0x53,0x10,0x1,0x3,0x18,0x5B,0x1D3,0x16,0x19,0x1D0,0x81,0x28,0x28,0x5D,0x29,0x10,0x1,0x3,0x18,0x5B,0x1E0,0x16,0x19,0x1DD,0x5,0x4352,0x4C45,0x4C,0x1,0x4,0x19,0x1EB,0x5,0x4344,0x4C45,0x4C,0x55,0x19,0x1F3,0x8,0x7664,0x7265,0x6973,0x6E6F,0x53,0x32,0x19,0x1FA,0x8,0x6563,0x6C6C,0x6973,0x657A,0x54,0x32,0x19,0x203,0xC,0x616D,0x6478,0x6369,0x6374,0x6C65,0x736C,0x55,0x32,0x19,0x20C,0x6,0x6828,0x7265,0x2965,0x1,0x3,0x19,0x217,0x3,0x776C,0x61,0x1,0x4,0x19,0x21F,0x9,0x7275,0x6D61,0x752D,0x6573,0x64,0x1,0x5,0x32,0x19,0x226,0x6,0x7473,0x7461,0x3F65,0x53,0xC,0xF,0x32,0x19,0x231,0xB,0x6572,0x6573,0x2D74,0x7473,0x7461,0x65,0x53,0x53,0xC,0xF,0x33,0x19,0x23B,0xC,0x7369,0x632D,0x6D6F,0x6970,0x696C,0x676E,0x54,0x53,0xC,0xF,0x33,0x19,0x249,0xA,0x6F63,0x706D,0x6C69,0x6E69,0x3F67,0x236,0x54,0x21,0x19,0x257,0xF,0x6F63,0x706D,0x6C69,0x6E69,0x2D67,0x6F77,0x6472,0x21,0x55,0xC,0xF,0x33,0x19,0x262,0x7,0x6172,0x736D,0x7A69,0x65,0x54,0xC,0xF,0x32,0x19,0x271,0x6,0x6974,0x6962,0x7864,0xC,0x5C,0x3,0xF,0x19,0x27C,0xA,0x6974,0x7762,0x726F,0x6964,0x7864,0xC,0x5C,0x4,0xF,0x19,0x286,0xA,0x6974,0x7762,0x726F,0x6C64,0x6E65,0xC,0x5C,0x5,0xF,0x19,0x292,0x3,0x6974,0x62,0xC,0x5C,0x6,0xF,0x19,0x29E,0x6,0x6974,0x6262,0x6675,0xC,0x5C,0x7,0xF,0x19,0x2A7,0x9,0x7275,0x6D61,0x732D,0x7A69,0x65,0x7,0x53,0xF,0x32,0x19,0x2B1,0x4,0x6162,0x6573,0x7,0x67,0xF,0x19,0x2BD,0x9,0x7066,0x702D,0x616C,0x6563,0x73,0x7,0x55,0xF,0x19,0x2C5,0x4,0x6973,0x7864,0x7,0x5C,0x3,0xF,0x32,0x19,0x2D0,0x4,0x6972,0x7864,0x7,0x5C,0x4,0xF,0x32,0x19,0x2DA,0x5,0x7364,0x656C,0x6E,0x7,0x5C,0x5,0xF,0x32,0x19,0x2E4,0x5,0x7372,0x656C,0x6E,0x7,0x5C,0x6,0xF,0x32,0x19,0x2EF,0x3,0x7364,0x61,0x7,0x5C,0x7,0xF,0x19,0x2FA,0x3,0x7372,0x61,0x2FE,0x2E9,0xF,0x19,0x303,0x1,0x54,0x2FE,0x2D4,0xF,0xE,0x19,0x30B,0x1,0x52,0x2FE,0x2DE,0xF,0xD,0x19,0x313,0x5,0x6564,0x7470,0x68,0x2D4,0x67,0xF,0x19,0x31B,0x6,0x656E,0x6167,0x6574,0x56,0x11,0x19,0x324,0x3,0x6F6E,0x74,0x1E,0x19,0x32C,0x2,0x2B32,0x55,0xF,0x19,0x332,0x2,0x2A32,0x55,0x11,0x19,0x338,0x2,0x2F32,0x55,0x12,0x19,0x33E,0x104,0x6432,0x7075,0x25,0x25,0x19,0x344,0x105,0x6432,0x6F72,0x70,0x22,0x22,0x19,0x34B,0x103,0x696E,0x70,0x25,0x1B,0x1B,0x19,0x353,0x5,0x7332,0x6177,0x70,0x26,0x30,0x26,0x31,0x19,0x35B,0x2,0x212B,0x23,0x30,0x65,0xF,0x31,0x33,0x19,0x365,0x4,0x6E69,0x7263,0x54,0x24,0x368,0x19,0x36F,0x4,0x6564,0x7263,0x56,0x24,0x368,0x19,0x377,0x4,0x6D2F,0x646F,0x25,0x25,0x12,0x30,0x14,0x31,0x19,0x37F,0xB,0x6628,0x6E69,0x2D64,0x6568,0x6461,0x29,0x3E,0x22,0x19,0x38A,0xB,0x6628,0x6E69,0x2D64,0x6F63,0x6564,0x29,0x3E,0x24,0x22,0x19,0x395,0x1,0x27,0x27,0x39D,0x19,0x3A1,0x83,0x275B,0x5D,0x27,0x39D,0x54,0x2E,0x2E,0x19,0x3A7,0x2,0x2627,0x27,0x392,0x19,0x3B1,0x84,0x275B,0x5D26,0x27,0x392,0x54,0x2E,0x2E,0x19,0x3B7,0x88,0x6F70,0x7473,0x6F70,0x656E,0x27,0x39D,0x2E,0x19,0x3C1,0x89,0x635B,0x6D6F,0x6970,0x656C,0x5D,0x3AB,0x1,0x2E,0x2E,0x19,0x3CB,0x6,0x7263,0x6165,0x6574,0x44,0x1,0x1,0x2E,0xB,0x335,0x2E,0x1,0x19,0x2E,0x19,0x3D7,0x8,0x6176,0x6972,0x6261,0x656C,0x44,0x1,0x3,0x2E,0x3C,0x2F,0x1,0x19,0x2E,0x19,0x3E7,0x8,0x6F63,0x736E,0x6174,0x746E,0x44,0x1,0x3,0x2E,0x2F,0x1,0x19,0x2E,0x19,0x3F7,0x7,0x7369,0x722D,0x6D61,0x3F,0x3,0x8000,0x0,0x15,0x19,0x406,0x85,0x6964,0x7463,0x40,0x1,0x32,0x2E,0x19,0x411,0x85,0x6964,0x7463,0x21,0x1,0x33,0x2E,0x19,0x41A,0x6,0x6464,0x6369,0x4074,0x23,0x32,0x24,0xD,0x32,0x24,0x1,0x10,0x1C,0x1A,0x19,0x423,0x6,0x6464,0x6369,0x2174,0x25,0x1,0x10,0x1D,0x25,0x33,0x24,0x5E,0xFFFF,0x15,0x24,0xD,0x33,0x19,0x433,0x82,0x6669,0x1,0x1,0x2E,0xB,0x53,0x2E,0x1,0x17,0x2E,0x19,0x446,0x84,0x6C65,0x6573,0xB,0x5C,0x3,0xF,0x24,0x33,0x1,0x1,0x2E,0xB,0x53,0x2E,0x1,0x16,0x2E,0x19,0x453,0x84,0x6874,0x6E65,0xB,0x24,0x33,0x19,0x467,0x84,0x7865,0x7469,0x1,0x19,0x2E,0x19,0x46F,0x83,0x6F66,0x72,0x1,0xE,0x2E,0x1,0x30,0x2E,0xB,0x19,0x477,0x84,0x656E,0x7478,0x1,0x31,0x2E,0x1,0xE,0x2E,0x1,0x23,0x2E,0x1,0x30,0x2E,0x1,0x20,0x2E,0x1,0x1,0x2E,0x2E,0x1,0x17,0x2E,0x1,0x31,0x2E,0x1,0x22,0x2E,0x19,0x483,0x82,0x6F64,0x1,0x24,0x2E,0x1,0x30,0x2E,0x1,0x30,0x2E,0xB,0x19,0x4A4,0x81,0x69,0x1,0x1,0x2E,0x53,0x2E,0x1,0xA,0x2E,0x19,0x4B2,0x81,0x6A,0x1,0x1,0x2E,0x55,0x2E,0x1,0xA,0x2E,0x19,0x4BE,0xA,0x6C5F,0x6165,0x6576,0x6F6C,0x706F,0x3,0x8000,0x138,0x19,0x4CA,0x85,0x656C,0x7661,0x65,0x1,0x1,0x2E,0xB,0x4D1,0x33,0x53,0x2E,0x1,0x16,0x2E,0x19,0x4D5,0x85,0x6C2B,0x6F6F,0x70,0x1,0x31,0x2E,0x1,0xF,0x2E,0x1,0x23,0x2E,0x1,0x30,0x2E,0x1,0x1,0x2E,0x54,0x2E,0x1,0xA,0x2E,0x1,0x2C,0x2E,0x1,0x1,0x2E,0x2E,0x1,0x17,0x2E,0x4D1,0x32,0x53,0x2B,0x5A,0x517,0x17,0xB,0x4D1,0x32,0x33,0x53,0x4D1,0x33,0x1,0x31,0x2E,0x1,0x31,0x2E,0x1,0x22,0x2E,0x1,0x22,0x2E,0x19,0x4E6,0x84,0x6F6C,0x706F,0x1,0x1,0x2E,0x54,0x2E,0x4EB,0x19,0x524,0x86,0x6E75,0x6F6C,0x706F,0x1,0x31,0x2E,0x1,0x31,0x2E,0x1,0x22,0x2E,0x1,0x22,0x2E,0x19,0x52F,0x85,0x6562,0x6967,0x6E,0xB,0x19,0x541,0x85,0x6761,0x6961,0x6E,0x1,0x1,0x2E,0x2E,0x1,0x16,0x2E,0x19,0x548,0x85,0x6877,0x6C69,0x65,0x1,0x1,0x2E,0xB,0x53,0x2E,0x1,0x17,0x2E,0x19,0x555,0x86,0x6572,0x6570,0x7461,0x1,0x1,0x2E,0x30,0x2E,0x1,0x16,0x2E,0xB,0x31,0x33,0x19,0x564,0x85,0x6E75,0x6974,0x6C,0x1,0x1,0x2E,0x2E,0x1,0x17,0x2E,0x19,0x575,0x5,0x6C61,0x6F6C,0x74,0x53,0x24,0x30,0x30,0x3C,0x22,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0x58B,0x17,0x31,0x66,0x22,0x22,0x19,0x582,0xA,0x7962,0x6574,0x612D,0x6C6C,0x746F,0x1F0,0x383,0xF,0x587,0x19,0x59F,0x3,0x6170,0x64,0x3,0x8000,0x9A,0x19,0x5AB,0x2,0x3152,0x3,0x8000,0x139,0x19,0x5B3,0x4,0x6F77,0x6472,0x5B6,0x33,0x53,0x5AF,0x33,0x28,0x23,0x5B6,0x32,0x21,0x25,0x1E,0x1A,0x5A,0x5D1,0x17,0x22,0x5AF,0x19,0x5AF,0x3F,0x5B,0x5C3,0x16,0x19,0x5BA,0x81,0x5B,0x243,0x19,0x5D7,0x1,0x5D,0x251,0x19,0x5DC,0xD,0x6177,0x7469,0x722D,0x6165,0x6164,0x6C62,0x65,0x54,0x4F,0x48,0x19,0x5E1,0xD,0x6177,0x7469,0x772D,0x6972,0x6174,0x6C62,0x65,0x55,0x4F,0x48,0x19,0x5EE,0x4,0x6573,0x7363,0x1,0xF,0x3D,0x19,0x5FB,0x2,0x736D,0x1,0xD,0x3D,0x19,0x603,0x2,0x7375,0x1,0xE,0x3D,0x19,0x60A,0x3,0x736E,0x40,0x1,0x1B,0x3D,0x19,0x611,0x7,0x7963,0x6C63,0x7365,0x40,0x1,0x1C,0x3D,0x19,0x619,0x6,0x6528,0x696D,0x2974,0x54,0x3D,0x19,0x623,0x4,0x6F70,0x6C6C,0x1,0x10,0x3D,0x19,0x62B,0x5,0x6B28,0x7965,0x29,0x55,0x3D,0x19,0x633,0xA,0x6173,0x6576,0x692D,0x616D,0x6567,0x1,0x3,0x3D,0x19,0x63B,0xD,0x6173,0x6576,0x732D,0x616E,0x7370,0x6F68,0x74,0x1,0x18,0x3D,0x19,0x646,0xD,0x6F6C,0x6461,0x732D,0x616E,0x7370,0x6F68,0x74,0x1,0x19,0x3D,0x19,0x653,0xE,0x7270,0x666F,0x6C69,0x2D65,0x6173,0x706D,0x656C,0x1,0x1A,0x3D,0x19,0x660,0x7,0x6E69,0x6C63,0x6475,0x65,0x1,0x4,0x3D,0x19,0x66D,0x9,0x706F,0x6E65,0x662D,0x6C69,0x65,0x1,0x5,0x3D,0x19,0x677,0x4,0x6573,0x6B65,0x1,0x6,0x3D,0x19,0x682,0xA,0x6C63,0x736F,0x2D65,0x6966,0x656C,0x1,0x7,0x3D,0x19,0x68A,0xB,0x6564,0x656C,0x6574,0x662D,0x6C69,0x65,0x1,0x8,0x3D,0x19,0x695,0xB,0x6F63,0x6E6E,0x6365,0x2D74,0x6374,0x70,0x1,0x11,0x3D,0x19,0x6A1,0x9,0x6C63,0x736F,0x2D65,0x6374,0x70,0x1,0x12,0x3D,0x19,0x6AD,0xA,0x7277,0x7469,0x2D65,0x7962,0x6574,0x1,0xA,0x3D,0x19,0x6B8,0x9,0x6572,0x6461,0x622D,0x7479,0x65,0x1,0x9,0x3D,0x19,0x6C3,0x9,0x7277,0x7469,0x2D65,0x7562,0x66,0x1,0xC,0x3D,0x19,0x6CE,0x8,0x6572,0x6461,0x622D,0x6675,0x1,0xB,0x3D,0x19,0x6D9,0x8,0x6C66,0x7375,0x2D68,0x6466,0x1,0x16,0x3D,0x19,0x6E3,0x6,0x7428,0x7079,0x2965,0x1,0x17,0x3D,0x19,0x6ED,0xC,0x6172,0x646E,0x6D6F,0x622D,0x7479,0x7365,0x1,0x13,0x3D,0x19,0x6F6,0x9,0x7067,0x6F69,0x6D2D,0x646F,0x65,0x1,0x64,0x3D,0x19,0x702,0x9,0x7067,0x6F69,0x722D,0x6165,0x64,0x1,0x65,0x3D,0x19,0x70D,0xA,0x7067,0x6F69,0x772D,0x6972,0x6574,0x1,0x66,0x3D,0x19,0x718,0xA,0x7073,0x2D69,0x6F63,0x666E,0x6769,0x1,0x67,0x3D,0x19,0x723,0x4,0x7073,0x7B69,0x1,0x68,0x3D,0x19,0x72E,0x4,0x7073,0x2169,0x1,0x69,0x3D,0x19,0x736,0x4,0x7073,0x4069,0x1,0x6A,0x3D,0x19,0x73E,0x4,0x737D,0x6970,0x1,0x6B,0x3D,0x19,0x746,0xA,0x3269,0x2D63,0x6F63,0x666E,0x6769,0x1,0x6C,0x3D,0x19,0x74E,0x9,0x3269,0x2D63,0x7473,0x7261,0x74,0x1,0x6D,0x3D,0x19,0x759,0xB,0x3269,0x2D63,0x6572,0x7473,0x7261,0x74,0x1,0x6E,0x3D,0x19,0x764,0x4,0x3269,0x2163,0x1,0x6F,0x3D,0x19,0x770,0x4,0x3269,0x4063,0x1,0x70,0x3D,0x19,0x778,0x8,0x3269,0x2D63,0x7473,0x706F,0x1,0x71,0x3D,0x19,0x780,0xA,0x6175,0x7472,0x622D,0x6765,0x6E69,0x1,0x72,0x3D,0x19,0x78A,0x8,0x6175,0x7472,0x652D,0x646E,0x1,0x73,0x3D,0x19,0x795,0x5,0x6175,0x7472,0x3F,0x1,0x74,0x3D,0x19,0x79F,0x5,0x6175,0x7472,0x40,0x1,0x75,0x3D,0x19,0x7A8,0x5,0x6175,0x7472,0x21,0x1,0x76,0x3D,0x19,0x7B1,0x4,0x772F,0x7464,0x1,0x77,0x3D,0x19,0x7BA,0x7,0x6477,0x2D74,0x7372,0x74,0x1,0x78,0x3D,0x19,0x7C2,0x5,0x6564,0x616C,0x79,0x1,0x79,0x3D,0x19,0x7CC,0x5,0x6C73,0x6565,0x70,0x1,0x7E,0x3D,0x19,0x7D5,0xB,0x6367,0x2D6D,0x6E65,0x7263,0x7079,0x74,0x1,0x7B,0x3D,0x19,0x7DE,0xB,0x6367,0x2D6D,0x6564,0x7263,0x7079,0x74,0x1,0x7C,0x3D,0x19,0x7EA,0x3,0x616D,0x63,0x1,0x7D,0x3D,0x19,0x7F6,0xB,0x6177,0x656B,0x722D,0x6165,0x6F73,0x6E,0x1,0x7F,0x3D,0x19,0x7FE,0x4,0x6F63,0x646C,0x1,0x80,0x3D,0x19,0x80A,0x7,0x6572,0x7473,0x7261,0x74,0x1,0x81,0x3D,0x19,0x812,0x7,0x7063,0x6675,0x6572,0x71,0x1,0x82,0x3D,0x19,0x81C,0x4,0x6F70,0x656B,0x1,0x83,0x3D,0x19,0x826,0x4,0x6570,0x6B65,0x1,0x84,0x3D,0x19,0x82E,0x8,0x7770,0x2D6D,0x7266,0x7165,0x1,0x85,0x3D,0x19,0x836,0x9,0x7770,0x2D6D,0x6172,0x676E,0x65,0x1,0x86,0x3D,0x19,0x840,0x8,0x7770,0x2D6D,0x7564,0x7974,0x1,0x87,0x3D,0x19,0x84B,0x9,0x7865,0x7469,0x692D,0x3066,0x2D,0x54,0x2A,0x5A,0x863,0x17,0x66,0x22,0x19,0x855,0x9,0x7865,0x7469,0x692D,0x3066,0x2B,0x56,0x2B,0x5A,0x872,0x17,0x66,0x22,0x19,0x864,0x6,0x655F,0x646E,0x666F,0x3,0x8000,0x13A,0x19,0x873,0x84,0x6163,0x6573,0x53,0x878,0x33,0x1,0x30,0x2E,0x19,0x87C,0x82,0x666F,0x1,0x9,0x2E,0x1,0x21,0x2E,0x449,0x19,0x887,0x85,0x6E65,0x6F64,0x66,0x878,0x373,0x457,0x19,0x892,0x87,0x6E65,0x6364,0x7361,0x65,0x878,0x32,0x53,0x24,0x30,0x30,0x46B,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0x8A7,0x17,0x31,0x66,0x22,0x22,0x1,0x31,0x2E,0x1,0x22,0x2E,0x19,0x89B,0x5,0x6F63,0x6E75,0x74,0x23,0x32,0x24,0xD,0x24,0x19,0x8C0,0xA,0x6964,0x7463,0x632D,0x756F,0x746E,0x8C5,0x19,0x8CB,0x3,0x6568,0x78,0x1,0x10,0x2C1,0x33,0x19,0x8D4,0x7,0x6564,0x6963,0x616D,0x6C,0x1,0xA,0x2C1,0x33,0x19,0x8DD,0x6,0x6962,0x616E,0x7972,0x55,0x2C1,0x33,0x19,0x8E8,0x3,0x6261,0x73,0x23,0x86B,0x56,0x11,0x19,0x8F1,0x3,0x696D,0x6E,0x25,0x25,0x2B,0x5A,0x909,0x17,0x24,0x22,0x5B,0x90A,0x16,0x22,0x19,0x8FA,0x3,0x616D,0x78,0x25,0x25,0x2A,0x5A,0x91A,0x17,0x24,0x22,0x5B,0x91B,0x16,0x22,0x19,0x90B,0x4,0x6863,0x7261,0x1,0x20,0x5BE,0xD,0x32,0x5E,0xFF,0x15,0x19,0x91C,0x86,0x635B,0x6168,0x5D72,0x1,0x1,0x2E,0x1,0x20,0x5BE,0xD,0x32,0x2E,0x19,0x929,0x5,0x6564,0x6566,0x72,0x44,0x1,0x19,0x2E,0x1,0x19,0x2E,0x19,0x938,0x82,0x7369,0x25E,0x5A,0x957,0x17,0x1,0x1,0x2E,0x3A4,0x2E,0x1,0x33,0x2E,0x5B,0x959,0x16,0x3A4,0x33,0x19,0x945,0x4,0x6D65,0x7469,0x628,0x19,0x95A,0x3,0x656B,0x79,0x638,0x19,0x960,0x8,0x632F,0x6E6F,0x6F73,0x656C,0x1,0x628,0x1,0x95E,0x33,0x1,0x638,0x1,0x964,0x33,0x19,0x966,0x2,0x7263,0x1,0xD,0x95E,0x1,0xA,0x95E,0x19,0x977,0x5,0x7073,0x6361,0x65,0x1,0x20,0x95E,0x19,0x981,0x82,0x2273,0x25E,0x5A,0x998,0x17,0x34,0x1,0x8C5,0x2E,0x5B,0x99C,0x16,0x1,0x22,0x5BE,0x8C5,0x19,0x98A,0x82,0x2263,0x25E,0x5A,0x9A8,0x17,0x34,0x5B,0x9AB,0x16,0x1,0x22,0x5BE,0x19,0x99D,0x4,0x7974,0x6570,0x1,0x95E,0x32,0x5F,0x628,0x21,0x5A,0x9BB,0x17,0x6F2,0x19,0x23,0x1F,0x5A,0x9DE,0x17,0x53,0x24,0x30,0x30,0x23,0x60,0x0,0xA,0x41,0x95E,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0x9C4,0x17,0x31,0x66,0x22,0x22,0x5B,0x9DF,0x16,0x22,0x22,0x19,0x9AC,0x5,0x6C66,0x7375,0x68,0x54,0x6E9,0x19,0x9E1,0x9,0x6964,0x7463,0x742D,0x7079,0x65,0x9B0,0x19,0x9E9,0x82,0x222E,0x25E,0x5A,0xA03,0x17,0x34,0x1,0x8C5,0x2E,0x1,0x9B0,0x2E,0x5B,0xA08,0x16,0x1,0x22,0x5BE,0x8C5,0x9B0,0x19,0x9F2,0x3,0x2E28,0x29,0x2D4,0xD,0x85C,0x69,0x8C5,0x9B0,0x19,0xA09,0x1,0x2E,0xA0D,0x986,0x19,0xA14,0x4,0x7528,0x292E,0x2D4,0xD,0x85C,0x6A,0x8C5,0x9B0,0x19,0xA1A,0x2,0x2E75,0xA1E,0x986,0x19,0xA25,0x2,0x2E68,0x2C1,0x32,0x24,0x8D8,0x1,0x24,0x95E,0xA17,0x2C1,0x33,0x19,0xA2B,0x2,0x2E62,0x2C1,0x32,0x24,0x8ED,0x1,0x25,0x95E,0xA28,0x2C1,0x33,0x19,0xA39,0x2,0x2E66,0x3,0x1,0x86A0,0x383,0xA0D,0x1,0x2E,0x95E,0x8F5,0xA17,0x19,0xA47,0x3,0x7566,0x2E,0x3,0x1,0x86A0,0x383,0xA1E,0x1,0x2E,0x95E,0xA28,0x19,0xA55,0x2,0x732E,0x1,0x3C,0x95E,0x2D4,0xD,0xA0D,0x1,0x3E,0x95E,0x986,0x2D4,0xD,0x85C,0x2D4,0xD,0x53,0x24,0x30,0x30,0x2FE,0x60,0x0,0xA,0xF,0x32,0xA17,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0xA79,0x17,0x31,0x66,0x22,0x22,0x19,0xA63,0x87,0x6572,0x7563,0x7372,0x65,0x223,0x32,0xD,0x8C5,0x5E,0x3F,0x15,0x55,0x383,0xF,0xF,0x1,0x1,0x2E,0x2E,0x1,0x29,0x2E,0x19,0xA92,0x5,0x6163,0x6464,0x72,0x44,0x1,0x3,0x2E,0x2F,0x1,0x1,0x2E,0x2E,0x1,0x19,0x2E,0x19,0xAAB,0x3,0x2B41,0x21,0x24,0x35,0x39,0x19,0xABD,0x87,0x7361,0x6573,0x7472,0x22,0x1,0x1E,0x2E,0x449,0x34,0x1,0x8C5,0x2E,0x1,0x9B0,0x2E,0x1,0x4,0x2E,0x46B,0x19,0xAC5,0xA,0x6264,0x7479,0x7365,0x703E,0x6461,0x8C5,0x53,0x24,0x30,0x30,0x23,0x60,0x0,0xA,0x41,0x5AF,0x3F,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0xAE7,0x17,0x31,0x66,0x22,0x22,0x19,0xADB,0x4,0x643F,0x7075,0x63,0x1E,0x5A,0xB0A,0x17,0x22,0x19,0xB00,0xD,0x7369,0x692D,0x6D6D,0x6465,0x6169,0x6574,0x3F,0x23,0xD,0x32,0x5E,0x80,0x15,0x19,0xB0B,0xD,0x7369,0x702D,0x6972,0x696D,0x6974,0x6576,0x3F,0x23,0xD,0x32,0x5E,0x40,0x15,0x19,0xB1B,0xA,0x7369,0x692D,0x6C6E,0x6E69,0x3F65,0x23,0xD,0x32,0x5E,0x100,0x15,0x19,0xB2B,0x5,0x6176,0x756C,0x65,0x3FD,0x19,0xB39,0x82,0x6F74,0x25E,0x5A,0xB55,0x17,0x1,0x3,0x2E,0x3A4,0x2F,0x1,0xD,0x2E,0x1,0x438,0x2E,0x5B,0xB58,0x16,0x3A4,0xD,0x438,0x19,0xB40,0x4,0x616D,0x6B72,0xB,0x44,0x1,0x1,0x2E,0x2E,0x1,0x19,0x2E,0x19,0xB59,0xE,0x6F66,0x6772,0x7465,0x742D,0x2D6F,0x616D,0x6B72,0x27,0x23,0x392,0x23,0x5A,0xB83,0x17,0x32,0x30,0x39D,0x29,0x21C,0x33,0x31,0x223,0x33,0x5B,0xB85,0x16,0x22,0x22,0x19,0xB67,0x7,0x6974,0x656D,0x692D,0x74,0x606,0x30,0x29,0x606,0x31,0x10,0xA17,0x1,0xB98,0x1,0xB9F,0x16,0xB,0x6D20,0x2073,0x6C65,0x7061,0x6573,0x64,0x8C5,0x9B0,0x97A,0x19,0xB86,0x5,0x4544,0x5542,0x47,0x3,0x0,0x0,0x19,0xBA3,0x8,0x6428,0x6265,0x6775,0x2922,0xBA8,0x53,0x21,0x5A,0xBBB,0x17,0x22,0x22,0x19,0x1,0xBC0,0x1,0xBC4,0x16,0x5,0x4423,0x4742,0x20,0x8C5,0x9B0,0x5FF,0xA17,0x1,0xBCD,0x1,0xBCF,0x16,0x2,0x203A,0x8C5,0x9B0,0xBA8,0x53,0x2B,0x5A,0xBD8,0x17,0x9B0,0xBA8,0x54,0x2B,0x5A,0xBE3,0x17,0x1,0x3A,0x95E,0x986,0xA66,0xBA8,0x55,0x2B,0x5A,0xBF2,0x17,0x964,0x5F,0x71,0x21,0x5A,0xBF2,0x17,0x31,0x19,0x97A,0x19,0xBAC,0x86,0x6564,0x7562,0x2267,0x98D,0x1,0xBB2,0x2E,0x19,0xBF4,0xC,0x6428,0x6265,0x6775,0x652D,0x6578,0x2963,0xBA8,0x53,0x21,0x5A,0xC0E,0x17,0x22,0x19,0x1,0xC13,0x1,0xC17,0x16,0x5,0x4423,0x4742,0x20,0x8C5,0x9B0,0x5FF,0xA17,0x1,0xC20,0x1,0xC22,0x16,0x2,0x203A,0x8C5,0x9B0,0xBA8,0x53,0x2B,0x5A,0xC2B,0x17,0x29,0xBA8,0x54,0x2B,0x5A,0xC36,0x17,0x1,0x3A,0x95E,0x986,0xA66,0xBA8,0x55,0x2B,0x5A,0xC45,0x17,0x964,0x5F,0x71,0x21,0x5A,0xC45,0x17,0x31,0x19,0x97A,0x19,0xBFE,0x8A,0x6564,0x7562,0x2D67,0x7865,0x6365,0x3AB,0x1,0xC06,0x2E,0x19,0xC47,0x6,0x642E,0x6265,0x6775,0xBA8,0x53,0x21,0x5A,0xC5F,0x17,0x19,0xBA8,0x53,0x2B,0x5A,0xC74,0x17,0x1,0xC6A,0x1,0xC6F,0x16,0x7,0x4423,0x4742,0x3A20,0x20,0x8C5,0x9B0,0x23,0xA17,0x97A,0x19,0xC53,0x6,0x656D,0x6F6D,0x7972,0x1,0x9,0x95E,0x1,0xC82,0x1,0xC86,0x16,0x6,0x6944,0x7463,0x203A,0x8C5,0x9B0,0xB,0xA17,0x1,0xC8F,0x1,0xC94,0x16,0x7,0x6563,0x6C6C,0x2073,0x28,0x8C5,0x9B0,0xB,0x33B,0xA17,0x1,0xC9E,0x1,0xCA9,0x16,0x13,0x7962,0x6574,0x2973,0x7520,0x6573,0x2064,0x756F,0x2074,0x666F,0x20,0x8C5,0x9B0,0x214,0xA17,0x1,0xCB2,0x1,0xCB6,0x16,0x6,0x6563,0x6C6C,0x2E73,0x8C5,0x9B0,0x1,0xCBD,0x1,0xCBF,0x16,0x2,0x2820,0x8C5,0x9B0,0xB,0x1,0x64,0x11,0x214,0x12,0xA17,0x1,0xCCD,0x1,0xCD2,0x16,0x8,0x2025,0x7375,0x6465,0x2E29,0x8C5,0x9B0,0x97A,0x1,0x9,0x95E,0x1,0xCDD,0x1,0xCE4,0x16,0xC,0x6F54,0x6174,0x206C,0x4152,0x204D,0x203A,0x8C5,0x9B0,0x277,0xA17,0x1,0xCED,0x1,0xCF2,0x16,0x7,0x6563,0x6C6C,0x2073,0x28,0x8C5,0x9B0,0x277,0x1F0,0x11,0xA17,0x1,0xCFD,0x1,0xD01,0x16,0x6,0x7962,0x6574,0x2973,0x8C5,0x9B0,0x97A,0x1,0x9,0x95E,0x1,0xD0C,0x1,0xD13,0x16,0xC,0x6144,0x6174,0x5320,0x6174,0x6B63,0x203A,0x8C5,0x9B0,0x2E9,0xA17,0x1,0xD1C,0x1,0xD21,0x16,0x7,0x6563,0x6C6C,0x2E73,0x20,0x8C5,0x9B0,0x1,0xD28,0x1,0xD30,0x16,0xE,0x6552,0x7574,0x6E72,0x5320,0x6174,0x6B63,0x203A,0x8C5,0x9B0,0x2F4,0xA17,0x1,0xD39,0x1,0xD3D,0x16,0x6,0x6563,0x6C6C,0x2E73,0x8C5,0x9B0,0x97A,0x1,0x9,0x95E,0x1,0xD48,0x1,0xD4E,0x16,0xA,0x7355,0x7265,0x5220,0x4D41,0x203A,0x8C5,0x9B0,0x22D,0xA17,0x1,0xD57,0x1,0xD5C,0x16,0x7,0x6563,0x6C6C,0x2073,0x28,0x8C5,0x9B0,0x22D,0x1F0,0x11,0xA17,0x1,0xD67,0x1,0xD72,0x16,0x13,0x7962,0x6574,0x2973,0x7520,0x6573,0x2064,0x756F,0x2074,0x666F,0x20,0x8C5,0x9B0,0x2B8,0xA17,0x1,0xD7B,0x1,0xD7F,0x16,0x5,0x6563,0x6C6C,0x73,0x8C5,0x9B0,0x97A,0x19,0xC75,0x5,0x6F77,0x6472,0x73,0x97A,0x53,0x5B6,0x33,0x223,0x32,0x23,0xD,0x8C5,0x5E,0x3F,0x15,0x23,0x5B6,0x65,0xF,0x1,0x4A,0x2B,0x5A,0xDA2,0x17,0x97A,0x53,0x5B6,0x33,0x23,0x5B6,0x368,0x9B0,0x986,0x986,0x55,0x5B6,0x368,0x32,0x23,0x53,0x21,0x5A,0xD8E,0x17,0x22,0x97A,0x19,0xD83,0x4,0x4028,0x292B,0x3A,0x3A,0x1,0x8,0x1C,0xF,0x19,0xDB5,0x8,0x7564,0x706D,0x6D2D,0x6D65,0x35,0x53,0x24,0x30,0x30,0xDB9,0xA2E,0x60,0x0,0xA,0x1,0x10,0x14,0x1E,0x5A,0xDD8,0x17,0x97A,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0xDCB,0x17,0x31,0x66,0x22,0x22,0x19,0xDC0,0x4,0x6E69,0x7469,0x96C,0x19,0xDEA,0x4,0x616E,0x656D,0xD,0x8C5,0x5E,0x3F,0x15,0x19,0xDF0,0x3,0x6663,0x61,0xD,0x23,0x32,0x5E,0x3F,0x15,0x55,0x383,0xF,0xF,0xD,0x19,0xDFA,0x9,0x6966,0x646E,0x6E2D,0x6D61,0x65,0x5B6,0x33,0x223,0x32,0x23,0xDFE,0x5B6,0x32,0x21,0x5A,0xE20,0x17,0xDF4,0x54,0x19,0x32,0x23,0x53,0x21,0x5A,0xE15,0x17,0x22,0x53,0x19,0xE0A,0xD,0x7270,0x666F,0x6C69,0x2D65,0x6572,0x6573,0x74,0x56,0x50,0x22,0x19,0xE2A,0x3,0x782E,0x74,0x23,0xE11,0x5A,0xE45,0x17,0x9B0,0x22,0x5B,0xE46,0x16,0xA17,0x19,0xE37,0xE,0x7270,0x666F,0x6C69,0x2D65,0x6572,0x6F70,0x7472,0x1,0xE55,0x1,0xE59,0x16,0x5,0x6163,0x6C6C,0x73,0x8C5,0x9B0,0x1,0x9,0x95E,0x1,0xE63,0x1,0xE68,0x16,0x7,0x7865,0x6C63,0x752D,0x73,0x8C5,0x9B0,0x1,0x9,0x95E,0x1,0xE72,0x1,0xE77,0x16,0x7,0x6E69,0x6C63,0x752D,0x73,0x8C5,0x9B0,0x1,0x9,0x95E,0x1,0xE81,0x1,0xE86,0x16,0x7,0x6173,0x706D,0x656C,0x73,0x8C5,0x9B0,0x1,0x9,0x95E,0x1,0xE90,0x1,0xE93,0x16,0x4,0x6F77,0x6472,0x8C5,0x9B0,0x97A,0x53,0x23,0x50,0x5A,0xEBA,0x17,0x30,0x30,0x30,0x30,0x31,0xA17,0x1,0x9,0x95E,0x31,0xA17,0x1,0x9,0x95E,0x31,0xA17,0x1,0x9,0x95E,0x31,0xA17,0x1,0x9,0x95E,0xE3B,0x97A,0xD,0x5B,0xE97,0x16,0x22,0x19,0xE47,0xD,0x706F,0x7473,0x7461,0x2D73,0x6572,0x6573,0x74,0x53,0x56,0x51,0x22,0x19,0xEBC,0x7,0x706F,0x6E2D,0x6D61,0x65,0x5B6,0x33,0x223,0x32,0x23,0xD,0x32,0x5E,0x40,0x15,0x5A,0xEE9,0x17,0x23,0xDFE,0x32,0x5B6,0x32,0x21,0x5A,0xEE9,0x17,0xDF4,0x54,0x19,0x32,0x23,0x53,0x21,0x5A,0xED4,0x17,0x22,0x53,0x19,0xECA,0x3,0x6F2E,0x70,0x23,0x56,0x21,0x5A,0xF0A,0x17,0x22,0x1,0xF03,0x1,0xF07,0x16,0x6,0x6328,0x6C61,0x296C,0x8C5,0x9B0,0x19,0x23,0xED0,0x5A,0xF14,0x17,0x9B0,0x22,0x5B,0xF1F,0x16,0x1,0xF19,0x1,0xF1C,0x16,0x3,0x706F,0x23,0x8C5,0x9B0,0xA17,0x19,0xEF3,0x8,0x6F2E,0x7370,0x6174,0x7374,0x1,0xF2B,0x1,0xF2F,0x16,0x5,0x6F63,0x6E75,0x74,0x8C5,0x9B0,0x1,0x9,0x95E,0x1,0xF39,0x1,0xF3D,0x16,0x6,0x706F,0x6F63,0x6564,0x8C5,0x9B0,0x97A,0x1,0x100,0x53,0x24,0x30,0x30,0x60,0x0,0xA,0x53,0x51,0x1E,0x5A,0xF55,0x17,0x5B,0xF68,0x16,0x5B,0xF5B,0x16,0xA17,0x1,0x9,0x95E,0xEF7,0x97A,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0xF46,0x17,0x31,0x66,0x22,0x22,0x1,0xF71,0x1,0xF75,0x16,0x5,0x6F63,0x6E75,0x74,0x8C5,0x9B0,0x1,0x9,0x95E,0x1,0xF7F,0x1,0xF82,0x16,0x4,0x6170,0x7269,0x8C5,0x9B0,0x97A,0x1,0x32,0x53,0x24,0x30,0x30,0x60,0x0,0xA,0x54,0x51,0x1E,0x5A,0xF9A,0x17,0x5B,0xFB0,0x16,0x5B,0xFA3,0x16,0xA17,0x1,0x9,0x95E,0x24,0xEF7,0x986,0xEF7,0x97A,0x58,0x1,0x31,0xF,0x23,0x30,0x1,0x1,0xA,0x2C,0x1,0xF8B,0x17,0x31,0x66,0x22,0x22,0x19,0x0,0x0,0x0,0x0,0x0,0x0
+}};
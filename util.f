@@ -92,6 +92,8 @@ variable _endof
 \ example:
 \   defer WORDS
 \   ' words is WORDS
+\
+\ is only reaches calls: words marked inline were compiled as copies.
 
 : defer
     (create)
@@ -141,9 +143,16 @@ defer key
 	34 word
     then ; immediate
 
+\ Hand whole strings to the host, unless emit has been redirected.
+\
 : type ( addr count - )
+    ['] emit @ ['] (emit) = if (type) exit then
     dup 0> if 0 do  dup i +c@ emit  loop else drop then drop ;
 
+\ Push out any console output still buffered (it goes out on newlines).
+\
+: flush ( - )  1 flush-fd ;
+
 : dict-type type ;
  
 : ."   compiling?
@@ -213,13 +222,16 @@ defer key
 : is-primitive? ( addr -- addr flag)
     dup 1+ @ 64 and ;
 
+: is-inline? ( addr -- addr flag)
+    dup 1+ @ 256 and ;
+
 
 \ Synonym of a constant...
 \
 : value constant ;
 
 \ While you can do defer/is for constants too (constants are just "words")...
-\ you can modify a constant directly if you wish.  
+\ you can modify a constant directly if you wish. Not one marked inline.
 \
 : to  ( u -<name> )
     compiling? if
@@ -331,3 +343,50 @@ defer key
     until
     drop 0 ;
 
+\ Profiling (needs a TBFORTH_PROFILE build, see Makefile): calls, exclusive
+\ and inclusive time (us) and samples (see profile-sample) per word, busiest
+\ first.
+\
+: profile-reset ( - ) -1 (profile) drop ;
+
+: .xt ( code - ) dup find-name if type drop else . then ;
+
+: profile-report ( - )
+    ." calls" 9 emit ." excl-us" 9 emit ." incl-us" 9 emit ." samples" 9 emit
+    ." word" cr
+    0 begin dup (profile) while
+	>r >r >r >r			\ n xt ( R: samples incl excl calls )
+	r> . 9 emit r> . 9 emit r> . 9 emit r> . 9 emit
+	.xt cr 1+
+    repeat drop ;
+
+\ Opcode counts (needs a TBFORTH_OPSTATS build, see Makefile): the busiest
+\ opcodes, then the 50 busiest pairs. Opcodes with no word (small literals,
+\ superinstructions) show as op#n, n from the opcode enum in tbforth.c.
+\ Calls of colon definitions show as (call).
+\
+: opstats-reset ( - ) 0 -1 (opstats) drop ;
+
+: op-name ( op - a cnt t|f )
+    R1 !
+    lwa @
+    begin
+	dup 1+ @ 64 and if dup cfa @ R1 @ = if name 1 exit then then
+	@ dup 0 =
+    until
+    drop 0 ;
+
+: .op ( op - )
+    dup -1 = if drop ." (call)" exit then
+    dup op-name if type drop else ." op#" . then ;
+
+: .opstats ( - )
+    ." count" 9 emit ." opcode" cr
+    256 0 do
+	i 0 (opstats) 0= if leave else . 9 emit .op cr then
+    loop
+    ." count" 9 emit ." pair" cr
+    50 0 do
+	i 1 (opstats) 0= if leave else . 9 emit swap .op space .op cr then
+    loop ;
+